@@ -52,7 +52,8 @@ NS_ASSUME_NONNULL_BEGIN
 /**
  * The value of the preference.
  *
- * This will return the `defaultValue` if it is set to nil, or if no value has been provided yet.
+ * This will return the `defaultValue` if it is set to nil, or if no value has been provided yet. The value is stored
+ * as a scalar, so this is cheaper to use than `value`.
  */
 
 @property (nonatomic) BOOL boolValue;
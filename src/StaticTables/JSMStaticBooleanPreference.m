@@ -32,17 +32,32 @@
 #pragma mark - User Interface
 
 - (void)loadControl {
-	UISwitch *toggle = [[UISwitch alloc] init];
-	toggle.on = self.boolValue;
-	[toggle addTarget:self action:@selector(toggleChanged:) forControlEvents:UIControlEventValueChanged];
+	super.control = (UIControl *)[[UISwitch alloc] init];
+}
+
+- (void)controlDidLoad {
+	[super controlDidLoad];
 
-	super.control = (UIControl *)toggle;
+	self.toggle.on = self.boolValue;
+	[self.toggle addTarget:self action:@selector(toggleChanged:) forControlEvents:UIControlEventValueChanged];
+}
+
+- (void)controlWillBeRecycled {
+	[super controlWillBeRecycled];
+
+	if( self.toggle.on != self.boolValue ) {
+		self.boolValue = self.toggle.on;
+	}
 }
 
 - (UISwitch *)toggle {
     return (UISwitch *)self.control;
 }
 
++ (CGSize)controlSize {
+	return CGSizeMake( 51, 31 );
+}
+
 - (BOOL)fitControlToCell {
     return NO;
 }
@@ -50,11 +65,11 @@
 #pragma mark - Updating the value
 
 - (BOOL)boolValue {
-    return self.value.boolValue;
+    return self.scalarBoolValue;
 }
 
 - (void)setBoolValue:(BOOL)boolValue {
-	self.value = @(boolValue);
+	self.scalarBoolValue = boolValue;
 }
 
 - (BOOL)defaultBoolValue {
@@ -74,7 +89,7 @@
 #pragma mark - Event Handling
 
 - (void)toggleChanged:(UISwitch *)toggle {
-    self.value = @(toggle.on);
+    self.boolValue = toggle.on;
 }
 
 @end
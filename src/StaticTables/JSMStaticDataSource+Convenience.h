@@ -127,6 +127,20 @@ NS_ASSUME_NONNULL_BEGIN
 
 - (void)removeSection:(__kindof JSMStaticSection *)section withRowAnimation:(UITableViewRowAnimation)animation NS_SWIFT_NAME(remove(_:with:));
 
+/**
+ * Replace the sections in the content structure, animating the differences.
+ *
+ * Sections and rows are matched by their `key`, or by identity if they don't have one, and the table view is updated
+ * with a single batch of insertions, deletions, moves and reloads. If a table view is not available, the data source is
+ * updated without animations, and if the table view is not visible, or doesn't reflect the current content, it is
+ * reloaded.
+ *
+ * @param sections The array of sections to display.
+ * @param animation The `UITableViewRowAnimation` you want to use for the update animation.
+ */
+
+- (void)setSections:(NSArray<__kindof JSMStaticSection *> *)sections withRowAnimation:(UITableViewRowAnimation)animation NS_SWIFT_NAME(setSections(_:with:));
+
 ///---------------------------------------------
 /// @name Animating the Rows
 ///---------------------------------------------
@@ -222,6 +236,20 @@ NS_ASSUME_NONNULL_BEGIN
 
 - (void)removeRow:(__kindof JSMStaticRow *)row withRowAnimation:(UITableViewRowAnimation)animation NS_SWIFT_NAME(remove(_:with:));
 
+/**
+ * Replace the rows in the given section, animating the differences.
+ *
+ * Rows are matched by their `key`, or by identity if they don't have one, and the table view is updated with a single
+ * batch of insertions, deletions, moves and reloads. If a table view is not available, the data source is updated
+ * without animations, and if the table view is not visible, or doesn't reflect the current content, it is reloaded.
+ *
+ * @param rows The array of rows to display within the section.
+ * @param section The section to update.
+ * @param animation The `UITableViewRowAnimation` you want to use for the update animation.
+ */
+
+- (void)setRows:(NSArray<__kindof JSMStaticRow *> *)rows forSection:(__kindof JSMStaticSection *)section withRowAnimation:(UITableViewRowAnimation)animation NS_SWIFT_NAME(setRows(_:for:with:));
+
 @end
 
 NS_ASSUME_NONNULL_END
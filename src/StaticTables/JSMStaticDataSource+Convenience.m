@@ -25,6 +25,13 @@
 #import "JSMStaticDataSource+Convenience.h"
 #import "JSMStaticSection.h"
 #import "JSMStaticRow.h"
+#import "JSMStaticDiff.h"
+
+@interface JSMStaticDataSource (JSMStaticDataSourceConvenience)
+
+- (void)replaceVisibleRow:(JSMStaticRow *)row withRow:(JSMStaticRow *)replacementRow;
+
+@end
 
 @implementation JSMStaticDataSource (Convenience)
 
@@ -71,6 +78,65 @@
 	[self animateSectionToIndex:NSNotFound fromIndex:sectionIndex withRowAnimation:animation];
 }
 
+- (void)setSections:(NSArray<JSMStaticSection *> *)sections withRowAnimation:(UITableViewRowAnimation)animation {
+	NSArray<JSMStaticSection *> *originalSections = self.sections;
+	NSMutableArray<NSArray<JSMStaticRow *> *> *originalRows = [NSMutableArray arrayWithCapacity:originalSections.count];
+	for( JSMStaticSection *section in originalSections ) {
+		[originalRows addObject:section.rows];
+	}
+	BOOL canAnimate = [self tableViewDisplaysSections:originalSections withRows:originalRows];
+
+	self.sections = sections;
+
+	if( self.tableView == nil ) {
+		return;
+	}
+	else if( ! canAnimate ) {
+		[self.tableView reloadData];
+		return;
+	}
+
+	NSArray<JSMStaticSection *> *updatedSections = self.sections;
+	JSMStaticDiff *diff = [JSMStaticDiff diffFromObjects:originalSections toObjects:updatedSections];
+	NSMutableIndexSet *deletedIndexes = diff.deletedIndexes.mutableCopy;
+	NSMutableIndexSet *insertedIndexes = diff.insertedIndexes.mutableCopy;
+	NSMutableIndexSet *movedIndexes = diff.movedIndexes.mutableCopy;
+
+	[self.tableView beginUpdates];
+
+	for( NSUInteger index = 0; index < originalSections.count; index++ ) {
+		NSUInteger updatedIndex = [diff updatedIndexForIndex:index];
+		if( updatedIndex == NSNotFound || [diff.reloadedIndexes containsIndex:index] ) {
+			continue;
+		}
+
+		JSMStaticDiff *rowDiff = [JSMStaticDiff diffFromObjects:originalRows[index] toObjects:updatedSections[updatedIndex].rows];
+		[self replaceVisibleRowsForDiff:rowDiff fromRows:originalRows[index] toRows:updatedSections[updatedIndex].rows];
+		if( ! rowDiff.hasChanges ) {
+			continue;
+		}
+
+		// Rows can't be updated within a section that is being moved, so we replace the section instead.
+		if( [movedIndexes containsIndex:index] ) {
+			[movedIndexes removeIndex:index];
+			[deletedIndexes addIndex:index];
+			[insertedIndexes addIndex:updatedIndex];
+			continue;
+		}
+
+		[self applyRowDiff:rowDiff fromSectionIndex:index toSectionIndex:updatedIndex withRowAnimation:animation];
+	}
+
+	[self.tableView deleteSections:deletedIndexes withRowAnimation:animation];
+	[self.tableView insertSections:insertedIndexes withRowAnimation:animation];
+	[self.tableView reloadSections:diff.reloadedIndexes withRowAnimation:animation];
+	[movedIndexes enumerateIndexesUsingBlock:^(NSUInteger index, BOOL *stop) {
+		[self.tableView moveSection:index toSection:[diff updatedIndexForIndex:index]];
+	}];
+
+	[self.tableView endUpdates];
+}
+
 #pragma mark - Animating the Rows
 
 - (JSMStaticRow *)createRowAtIndexPath:(NSIndexPath *)indexPath withRowAnimation:(UITableViewRowAnimation)animation {
@@ -123,6 +189,40 @@
 	[self animateRowToIndexPath:nil fromIndexPath:indexPath withRowAnimation:animation];
 }
 
+- (void)setRows:(NSArray<JSMStaticRow *> *)rows forSection:(JSMStaticSection *)section withRowAnimation:(UITableViewRowAnimation)animation {
+	NSArray<JSMStaticRow *> *originalRows = section.rows;
+	NSUInteger sectionIndex = [self indexForSection:section];
+	BOOL canAnimate = sectionIndex != NSNotFound && [self tableViewDisplaysSections:self.sections withRows:nil];
+
+	// Taking rows from another of our sections changes that section too, which we don't animate.
+	for( JSMStaticRow *row in rows ) {
+		if( row.section != nil && row.section != section && row.section.dataSource == self ) {
+			canAnimate = NO;
+			break;
+		}
+	}
+
+	section.rows = rows;
+
+	if( self.tableView == nil || sectionIndex == NSNotFound ) {
+		return;
+	}
+	else if( ! canAnimate ) {
+		[self.tableView reloadData];
+		return;
+	}
+
+	JSMStaticDiff *diff = [JSMStaticDiff diffFromObjects:originalRows toObjects:section.rows];
+	[self replaceVisibleRowsForDiff:diff fromRows:originalRows toRows:section.rows];
+	if( ! diff.hasChanges ) {
+		return;
+	}
+
+	[self.tableView beginUpdates];
+	[self applyRowDiff:diff fromSectionIndex:sectionIndex toSectionIndex:sectionIndex withRowAnimation:animation];
+	[self.tableView endUpdates];
+}
+
 #pragma mark - Performing the actual animations
 
 - (void)animateSectionToIndex:(NSUInteger)toIndex fromIndex:(NSUInteger)fromIndex withRowAnimation:(UITableViewRowAnimation)animation {
@@ -173,4 +273,63 @@
 	}
 }
 
+#pragma mark - Applying Differences
+
+- (BOOL)tableViewDisplaysSections:(NSArray<JSMStaticSection *> *)sections withRows:(NSArray<NSArray<JSMStaticRow *> *> *)rows {
+	if( self.tableView == nil || self.tableView.window == nil ) {
+		return NO;
+	}
+
+	if( self.tableView.numberOfSections != (NSInteger)sections.count ) {
+		return NO;
+	}
+
+	for( NSUInteger index = 0; index < sections.count; index++ ) {
+		NSUInteger numberOfRows = rows != nil ? rows[index].count : sections[index].numberOfRows;
+		if( [self.tableView numberOfRowsInSection:index] != (NSInteger)numberOfRows ) {
+			return NO;
+		}
+	}
+
+	return YES;
+}
+
+// Rows that were replaced by an equivalent row keep their cell, which needs to be handed over to the replacement.
+- (void)replaceVisibleRowsForDiff:(JSMStaticDiff *)diff fromRows:(NSArray<JSMStaticRow *> *)originalRows toRows:(NSArray<JSMStaticRow *> *)updatedRows {
+	for( NSUInteger index = 0; index < originalRows.count; index++ ) {
+		NSUInteger updatedIndex = [diff updatedIndexForIndex:index];
+		if( updatedIndex == NSNotFound || [diff.reloadedIndexes containsIndex:index] ) {
+			continue;
+		}
+
+		[self replaceVisibleRow:originalRows[index] withRow:updatedRows[updatedIndex]];
+	}
+}
+
+- (void)applyRowDiff:(JSMStaticDiff *)diff fromSectionIndex:(NSUInteger)fromSectionIndex toSectionIndex:(NSUInteger)toSectionIndex withRowAnimation:(UITableViewRowAnimation)animation {
+	NSMutableArray<NSIndexPath *> *deletedIndexPaths = [NSMutableArray arrayWithCapacity:diff.deletedIndexes.count];
+	[diff.deletedIndexes enumerateIndexesUsingBlock:^(NSUInteger index, BOOL *stop) {
+		[deletedIndexPaths addObject:[NSIndexPath indexPathForRow:index inSection:fromSectionIndex]];
+	}];
+
+	NSMutableArray<NSIndexPath *> *insertedIndexPaths = [NSMutableArray arrayWithCapacity:diff.insertedIndexes.count];
+	[diff.insertedIndexes enumerateIndexesUsingBlock:^(NSUInteger index, BOOL *stop) {
+		[insertedIndexPaths addObject:[NSIndexPath indexPathForRow:index inSection:toSectionIndex]];
+	}];
+
+	NSMutableArray<NSIndexPath *> *reloadedIndexPaths = [NSMutableArray arrayWithCapacity:diff.reloadedIndexes.count];
+	[diff.reloadedIndexes enumerateIndexesUsingBlock:^(NSUInteger index, BOOL *stop) {
+		[reloadedIndexPaths addObject:[NSIndexPath indexPathForRow:index inSection:fromSectionIndex]];
+	}];
+
+	[self.tableView deleteRowsAtIndexPaths:deletedIndexPaths withRowAnimation:animation];
+	[self.tableView insertRowsAtIndexPaths:insertedIndexPaths withRowAnimation:animation];
+	[self.tableView reloadRowsAtIndexPaths:reloadedIndexPaths withRowAnimation:animation];
+	[diff.movedIndexes enumerateIndexesUsingBlock:^(NSUInteger index, BOOL *stop) {
+		NSIndexPath *fromIndexPath = [NSIndexPath indexPathForRow:index inSection:fromSectionIndex];
+		NSIndexPath *toIndexPath = [NSIndexPath indexPathForRow:[diff updatedIndexForIndex:index] inSection:toSectionIndex];
+		[self.tableView moveRowAtIndexPath:fromIndexPath toIndexPath:toIndexPath];
+	}];
+}
+
 @end
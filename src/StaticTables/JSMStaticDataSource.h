@@ -27,6 +27,7 @@
 @class JSMStaticDataSource;
 @class JSMStaticSection;
 @class JSMStaticRow;
+@protocol JSMStaticPreferenceStorage;
 
 NS_ASSUME_NONNULL_BEGIN
 
@@ -135,7 +136,7 @@ NS_ASSUME_NONNULL_BEGIN
  * A `JSMStaticDataSource` objects can act as a data source for a `UITableView`.
  */
 
-@interface JSMStaticDataSource : NSObject <UITableViewDataSource>
+@interface JSMStaticDataSource : NSObject <UITableViewDataSource, UITableViewDataSourcePrefetching>
 
 ///---------------------------------------------
 /// @name Managing the Table View
@@ -194,6 +195,63 @@ NS_ASSUME_NONNULL_BEGIN
 
 + (void)setCellClass:(Class)cellClass NS_SWIFT_NAME(setCellClass(_:));
 
+/**
+ * Register a cell class and style with the reciever's table view, so that cells can be created by the table view when
+ * dequeuing instead of being allocated by the data source.
+ *
+ * Registrations are retained by the reciever and applied to any table view it supplies data to. Table views always
+ * initialise registered cells with `UITableViewCellStyleDefault`, so the given class should either be used for rows with
+ * that style, or override `initWithStyle:reuseIdentifier:` to apply the given style itself.
+ *
+ * @param cellClass The class to register, which must be a subclass of `UITableViewCell`.
+ * @param style The cell style that rows using the class will have.
+ */
+
+- (void)registerCellClass:(Class)cellClass withStyle:(UITableViewCellStyle)style NS_SWIFT_NAME(register(_:style:));
+
+/**
+ * The reuse identifier used by all data sources for cells of the given class and style.
+ *
+ * Identifiers are created once per class and cached, so this is inexpensive to call while scrolling.
+ *
+ * @param cellClass The class of table view cell.
+ * @param style The cell style.
+ * @return The reuse identifier for cells of the given class and style.
+ */
+
++ (NSString *)reuseIdentifierForCellClass:(Class)cellClass style:(UITableViewCellStyle)style NS_SWIFT_NAME(reuseIdentifier(for:style:));
+
+///---------------------------------------------
+/// @name Storing Preferences
+///---------------------------------------------
+
+/**
+ * The storage backend used by the preferences within the reciever that don't provide their own.
+ *
+ * If this is nil, preferences are stored in the standard user defaults.
+ */
+
+@property (nonatomic, strong, nullable) id<JSMStaticPreferenceStorage> preferenceStorage;
+
+///---------------------------------------------
+/// @name Comparing Sections and Rows
+///---------------------------------------------
+
+/**
+ * Flag indicating whether sections and rows are compared by identity when looking them up within the content structure.
+ *
+ * By default, methods such as `indexForSection:`, `containsSection:` and `removeRow:` (as well as the equivalent methods
+ * on `JSMStaticSection`) compare sections and rows using `isEqualToSection:` and `isEqualToRow:`, which means an equal
+ * instance that was never added to the data source can be used to find one that was. For sections and rows without keys,
+ * this involves comparing their content, which can become expensive as the content structure grows.
+ *
+ * When set to `YES`, only the exact instances contained in the data source are found, allowing these lookups to be
+ * performed in constant time. Value equality can still be tested explicitly with `isEqualToSection:` and `isEqualToRow:`.
+ * Defaults to `NO`.
+ */
+
+@property (nonatomic) BOOL usesIdentityComparison;
+
 ///---------------------------------------------
 /// @name Managing the Sections
 ///---------------------------------------------
@@ -378,6 +436,33 @@ NS_ASSUME_NONNULL_BEGIN
 
 - (void)removeRow:(__kindof JSMStaticRow *)row NS_SWIFT_NAME(remove(_:));
 
+///---------------------------------------------
+/// @name Batching Mutations
+///---------------------------------------------
+
+typedef void(^JSMStaticDataSourceMutations)(void);
+
+/**
+ * Perform a group of mutations to the content structure, notifying delegates only once they have all been applied.
+ *
+ * Normally, every section or row that is added or removed results in an immediate call to `dataSource:sectionsDidChange:`
+ * or `section:rowsDidChange:`. Within the given block, these calls are deferred, and once the block returns, the data
+ * source's delegate is called once (if the sections were changed), and each section whose rows were changed calls its
+ * delegate once. Until then, any modifications the delegates would make (such as sorting) will not have been applied.
+ *
+ * Calls to this method can be nested, in which case delegates are notified when the outermost block returns.
+ *
+ * @param mutations A block that performs mutations to the reciever, and the sections it contains.
+ */
+
+- (void)performBatchMutations:(JSMStaticDataSourceMutations)mutations NS_SWIFT_NAME(performBatchMutations(_:));
+
+/**
+ * Flag indicating if the reciever is currently within a call to `performBatchMutations:`.
+ */
+
+@property (nonatomic, readonly, getter=isPerformingBatchMutations) BOOL performingBatchMutations;
+
 @end
 
 NS_ASSUME_NONNULL_END
@@ -30,6 +30,26 @@
 
 @property (nonatomic, strong) NSMutableArray *mutableSections;
 
+@property (nonatomic, strong) NSMapTable *sectionsByKey;
+
+@property (nonatomic, strong) NSMapTable *rowsByKey;
+
+@property (nonatomic) NSUInteger batchMutationsDepth;
+
+@property (nonatomic) BOOL sectionsChangedDuringBatch;
+
+@property (nonatomic, strong) NSMutableArray *sectionsWithChangedRows;
+
+@property (nonatomic, strong) NSMutableDictionary *registeredCellClasses;
+
+@property (nonatomic, weak) UITableView *registeredTableView;
+
+@property (nonatomic, strong) NSMapTable *cellConfigurations;
+
+@property (nonatomic, strong) NSMapTable *visibleCellsByRow;
+
+@property (nonatomic, strong) NSMapTable *visibleRowsByCell;
+
 @end
 
 @interface JSMStaticSection (JSMStaticDataSource)
@@ -38,12 +58,40 @@
 
 - (void)setDirty:(BOOL)dirty;
 
+- (NSMutableArray *)mutableRows;
+
+- (NSUInteger)indexInDataSource;
+
+- (void)setIndexInDataSource:(NSUInteger)index;
+
+- (void)rowsDidChange;
+
 @end
 
 @interface JSMStaticRow (JSMStaticDataSource)
 
 - (void)prepareCell:(UITableViewCell *)cell;
 
+- (NSUInteger)indexInSection;
+
+- (NSUInteger)contentGeneration;
+
+- (BOOL)hasCustomContent;
+
+- (void)prefetchImage;
+
+- (void)cancelPrefetchingImage;
+
+@end
+
+@interface JSMStaticCellConfiguration : NSObject
+
+@property (nonatomic, weak) JSMStaticRow *row;
+
+@property (nonatomic) NSUInteger generation;
+
+@property (nonatomic) BOOL customContent;
+
 @end
 
 @implementation JSMStaticDataSource
@@ -54,6 +102,10 @@
     if( ( self = [super init] ) ) {
         _cellClass = self.class.cellClass;
         _mutableSections = [NSMutableArray array];
+        _sectionsByKey = [NSMapTable strongToStrongObjectsMapTable];
+        _rowsByKey = [NSMapTable strongToStrongObjectsMapTable];
+        _registeredCellClasses = [NSMutableDictionary dictionary];
+        _cellConfigurations = [NSMapTable weakToStrongObjectsMapTable];
     }
     return self;
 }
@@ -82,6 +134,57 @@ static Class _staticCellClass = nil;
     _staticCellClass = cellClass;
 }
 
++ (NSString *)reuseIdentifierForCellClass:(Class)cellClass style:(UITableViewCellStyle)style {
+	static NSMapTable *reuseIdentifiers = nil;
+	static dispatch_once_t onceToken;
+	dispatch_once(&onceToken, ^{
+		reuseIdentifiers = [NSMapTable strongToStrongObjectsMapTable];
+	});
+
+	// Build the identifiers for every style at once, indexed by the style.
+	NSArray<NSString *> *identifiers = [reuseIdentifiers objectForKey:cellClass];
+	if( identifiers == nil ) {
+		identifiers = @[
+			[NSString stringWithFormat:@"JSMStaticDataSourceDefaultReuseIdentifier.%@", cellClass],
+			[NSString stringWithFormat:@"JSMStaticDataSourceValue1ReuseIdentifier.%@", cellClass],
+			[NSString stringWithFormat:@"JSMStaticDataSourceValue2ReuseIdentifier.%@", cellClass],
+			[NSString stringWithFormat:@"JSMStaticDataSourceSubtitleReuseIdentifier.%@", cellClass],
+		];
+		[reuseIdentifiers setObject:identifiers forKey:cellClass];
+	}
+
+	return identifiers[[self normalizedCellStyle:style]];
+}
+
++ (UITableViewCellStyle)normalizedCellStyle:(UITableViewCellStyle)style {
+	switch( style ) {
+		case UITableViewCellStyleDefault:
+		case UITableViewCellStyleValue2:
+		case UITableViewCellStyleSubtitle:
+			return style;
+		case UITableViewCellStyleValue1:
+		default:
+			return UITableViewCellStyleValue1;
+	}
+}
+
+- (void)registerCellClass:(Class)cellClass withStyle:(UITableViewCellStyle)style {
+	NSString *reuseIdentifier = [self.class reuseIdentifierForCellClass:cellClass style:style];
+	self.registeredCellClasses[reuseIdentifier] = cellClass;
+	[_tableView registerClass:cellClass forCellReuseIdentifier:reuseIdentifier];
+}
+
+- (void)registerCellClassesWithTableView:(UITableView *)tableView {
+	if( tableView == self.registeredTableView ) {
+		return;
+	}
+
+	self.registeredTableView = tableView;
+	[self.registeredCellClasses enumerateKeysAndObjectsUsingBlock:^(NSString *reuseIdentifier, Class cellClass, BOOL *stop) {
+		[tableView registerClass:cellClass forCellReuseIdentifier:reuseIdentifier];
+	}];
+}
+
 #pragma mark - Accessing sections
 
 - (NSArray *)sections {
@@ -93,7 +196,11 @@ static Class _staticCellClass = nil;
 }
 
 - (JSMStaticSection *)sectionWithKey:(id)key {
-	return [[self.mutableSections filteredArrayUsingPredicate:[NSPredicate predicateWithFormat:@"key = %@",key]] firstObject];
+	if( key == nil ) {
+		return nil;
+	}
+
+	return [self.sectionsByKey objectForKey:key];
 }
 
 - (JSMStaticSection *)sectionAtIndex:(NSUInteger)index {
@@ -105,10 +212,28 @@ static Class _staticCellClass = nil;
 }
 
 - (NSUInteger)indexForSection:(JSMStaticSection *)section {
+	// Sections contained in the receiver know their own index, so we only need to search for sections that don't.
+	NSUInteger index = section.indexInDataSource;
+	if( section.dataSource == self && index < self.mutableSections.count && self.mutableSections[index] == section ) {
+		return index;
+	}
+
+	if( self.usesIdentityComparison ) {
+		return section.dataSource == self ? [self.mutableSections indexOfObjectIdenticalTo:section] : NSNotFound;
+	}
+
 	return [self.mutableSections indexOfObject:section];
 }
 
 - (BOOL)containsSection:(JSMStaticSection *)section {
+	if( section.dataSource == self ) {
+		return YES;
+	}
+
+	if( self.usesIdentityComparison ) {
+		return NO;
+	}
+
 	return [self.mutableSections containsObject:section];
 }
 
@@ -117,6 +242,9 @@ static Class _staticCellClass = nil;
 - (void)setSections:(NSArray *)sections {
 	if( self.mutableSections.count > 0 ) {
 		[self.mutableSections makeObjectsPerformSelector:@selector(setDataSource:) withObject:nil];
+		for( JSMStaticSection *section in self.mutableSections ) {
+			section.indexInDataSource = NSNotFound;
+		}
 		[self.mutableSections removeAllObjects];
 	}
 	
@@ -126,9 +254,12 @@ static Class _staticCellClass = nil;
 		}
 		
 		section.dataSource = self;
+		section.indexInDataSource = self.mutableSections.count;
 		
 		[self.mutableSections addObject:section];
 	}
+
+	[self reindex];
 	
 	[self sectionsDidChange];
 }
@@ -157,8 +288,10 @@ static Class _staticCellClass = nil;
 	NSAssert(index != NSNotFound, @"You cannot insert a section at NSNotFound.");
 	
 	// Remove from the existing data source
+	BOOL isMove = NO;
+	NSUInteger firstChangedIndex = index;
 	if( section.dataSource == self ) {
-		NSUInteger oldIndex = [self.mutableSections indexOfObject:section];
+		NSUInteger oldIndex = [self indexForSection:section];
 		
 		if( index == oldIndex || index == oldIndex + 1 ) {
 			return;
@@ -168,6 +301,9 @@ static Class _staticCellClass = nil;
 		}
 		
 		[self.mutableSections removeObjectAtIndex:oldIndex];
+		isMove = YES;
+
+		firstChangedIndex = MIN( oldIndex, index );
 	}
 	else if( section.dataSource != nil ) {
 		[section.dataSource removeSection:section];
@@ -181,6 +317,15 @@ static Class _staticCellClass = nil;
     else {
         [self.mutableSections insertObject:section atIndex:index];
     }
+	[self updateSectionIndexesFromIndex:MIN( firstChangedIndex, self.mutableSections.count - 1 )];
+
+	// Moving a section changes which of the rows sharing a key comes first, so we rebuild the index.
+	if( isMove ) {
+		[self reindex];
+	}
+	else {
+		[self indexSection:section];
+	}
 	
 	[self sectionsDidChange];
 }
@@ -198,7 +343,7 @@ static Class _staticCellClass = nil;
 }
 
 - (void)removeSection:(JSMStaticSection *)section {
-	NSUInteger index = [self.mutableSections indexOfObject:section];
+	NSUInteger index = [self indexForSection:section];
 	
 	if( index == NSNotFound ) {
 		return;
@@ -211,7 +356,10 @@ static Class _staticCellClass = nil;
 	NSAssert(index != NSNotFound, @"You cannot remove a section at NSNotFound.");
 	
 	section.dataSource = nil;
+	section.indexInDataSource = NSNotFound;
 	[self.mutableSections removeObjectAtIndex:index];
+	[self updateSectionIndexesFromIndex:index];
+	[self unindexSection:section];
 	
 	[self sectionsDidChange];
 }
@@ -222,31 +370,141 @@ static Class _staticCellClass = nil;
     }
 
 	[self.mutableSections makeObjectsPerformSelector:@selector(setDataSource:) withObject:nil];
+	for( JSMStaticSection *section in self.mutableSections ) {
+		section.indexInDataSource = NSNotFound;
+	}
 	[self.mutableSections removeAllObjects];
+	[self reindex];
 
 	[self sectionsDidChange];
 }
 
 - (void)sectionsDidChange {
+	if( self.isPerformingBatchMutations ) {
+		self.sectionsChangedDuringBatch = YES;
+		return;
+	}
+
 	if( self.delegate != nil && [self.delegate respondsToSelector:@selector(dataSource:sectionsDidChange:)] ) {
 		_mutableSections = [[self.delegate dataSource:self sectionsDidChange:_mutableSections.copy] mutableCopy];
+
+		// The delegate may have reordered the sections, so the first section or row for a given key may have changed.
+		[self updateSectionIndexesFromIndex:0];
+		[self reindex];
+	}
+}
+
+#pragma mark - Indexing
+
+// Each section keeps track of its own index within the data source, so `indexForSection:` doesn't need to search the
+// sections. Any mutation of the `mutableSections` array needs to be followed by updating the index of every section
+// after the mutation.
+
+- (void)updateSectionIndexesFromIndex:(NSUInteger)index {
+	NSUInteger count = self.mutableSections.count;
+	for( NSUInteger i = index; i < count; i++ ) {
+		[(JSMStaticSection *)self.mutableSections[i] setIndexInDataSource:i];
+	}
+}
+
+// Sections and rows are indexed by key so that `sectionWithKey:` and `rowWithKey:` don't need to search the entire
+// structure. Where more than one section or row shares a key, only the first is indexed, so these methods should be
+// called *after* the `mutableSections` array (or the section's rows) have been updated.
+
+- (BOOL)row:(JSMStaticRow *)row precedesRow:(JSMStaticRow *)otherRow {
+	if( row.section != otherRow.section ) {
+		return row.section.indexInDataSource < otherRow.section.indexInDataSource;
+	}
+
+	return row.indexInSection < otherRow.indexInSection;
+}
+
+- (void)section:(JSMStaticSection *)section didAddRow:(JSMStaticRow *)row {
+	if( row.key == nil ) {
+		return;
+	}
+
+	JSMStaticRow *indexedRow = [self.rowsByKey objectForKey:row.key];
+
+	if( indexedRow == nil || ( indexedRow != row && [self row:row precedesRow:indexedRow] ) ) {
+		[self.rowsByKey setObject:row forKey:row.key];
+	}
+}
+
+- (void)section:(JSMStaticSection *)section didRemoveRow:(JSMStaticRow *)row {
+	if( row.key == nil || [self.rowsByKey objectForKey:row.key] != row ) {
+		return;
+	}
+
+	[self.rowsByKey removeObjectForKey:row.key];
+
+	// Fall back to the next row with the same key, if there is one.
+	for( JSMStaticSection *otherSection in self.mutableSections ) {
+		JSMStaticRow *otherRow = [otherSection rowWithKey:row.key];
+		if( otherRow != nil && otherRow != row ) {
+			[self.rowsByKey setObject:otherRow forKey:row.key];
+			break;
+		}
+	}
+}
+
+- (void)indexSection:(JSMStaticSection *)section {
+	if( section.key != nil ) {
+		JSMStaticSection *indexedSection = [self.sectionsByKey objectForKey:section.key];
+
+		if( indexedSection == nil || ( indexedSection != section && section.indexInDataSource < indexedSection.indexInDataSource ) ) {
+			[self.sectionsByKey setObject:section forKey:section.key];
+		}
+	}
+
+	for( JSMStaticRow *row in section.mutableRows ) {
+		[self section:section didAddRow:row];
+	}
+}
+
+- (void)unindexSection:(JSMStaticSection *)section {
+	if( section.key != nil && [self.sectionsByKey objectForKey:section.key] == section ) {
+		[self.sectionsByKey removeObjectForKey:section.key];
+
+		// Fall back to the next section with the same key, if there is one.
+		for( JSMStaticSection *otherSection in self.mutableSections ) {
+			if( otherSection != section && [otherSection.key isEqual:section.key] ) {
+				[self.sectionsByKey setObject:otherSection forKey:section.key];
+				break;
+			}
+		}
+	}
+
+	for( JSMStaticRow *row in section.mutableRows ) {
+		[self section:section didRemoveRow:row];
+	}
+}
+
+- (void)reindex {
+	[self.sectionsByKey removeAllObjects];
+	[self.rowsByKey removeAllObjects];
+
+	for( JSMStaticSection *section in self.mutableSections ) {
+		if( section.key != nil && [self.sectionsByKey objectForKey:section.key] == nil ) {
+			[self.sectionsByKey setObject:section forKey:section.key];
+		}
+
+		for( JSMStaticRow *row in section.mutableRows ) {
+			if( row.key != nil && [self.rowsByKey objectForKey:row.key] == nil ) {
+				[self.rowsByKey setObject:row forKey:row.key];
+			}
+		}
 	}
 }
 
 #pragma mark - Accessing rows
 
 - (JSMStaticRow *)rowWithKey:(id)key {
-	__block JSMStaticRow *foundRow;
-	
-	[self.mutableSections enumerateObjectsUsingBlock:^(JSMStaticSection *section, NSUInteger idx, BOOL *stop) {
-		JSMStaticRow *row = [section rowWithKey:key];
-		if( row != nil ) {
-			foundRow = row;
-			*stop = YES;
-		}
-	}];
-	
-	return foundRow;
+	if( key == nil ) {
+		return nil;
+	}
+
+	return [self.rowsByKey objectForKey:key];
 }
 
 - (JSMStaticRow *)rowAtIndexPath:(NSIndexPath *)indexPath {
@@ -264,7 +522,7 @@ static Class _staticCellClass = nil;
 	}
 	NSInteger sectionIndex = (NSInteger)[self indexForSection:section];
 	NSInteger rowIndex = (NSInteger)[section indexForRow:row];
-	if( rowIndex == NSNotFound || rowIndex < 0 ) {
+	if( sectionIndex == NSNotFound || sectionIndex < 0 || rowIndex == NSNotFound || rowIndex < 0 ) {
 		return nil;
 	}
 	return [NSIndexPath indexPathForRow:rowIndex inSection:sectionIndex];
@@ -304,6 +562,51 @@ static Class _staticCellClass = nil;
     [self removeRowAtIndexPath:indexPath];
 }
 
+#pragma mark - Batching Mutations
+
+- (BOOL)isPerformingBatchMutations {
+	return self.batchMutationsDepth > 0;
+}
+
+- (void)performBatchMutations:(JSMStaticDataSourceMutations)mutations {
+	self.batchMutationsDepth += 1;
+
+	if( mutations != nil ) {
+		mutations();
+	}
+
+	self.batchMutationsDepth -= 1;
+
+	if( self.batchMutationsDepth > 0 ) {
+		return;
+	}
+
+	// Each section notifies its delegate once, regardless of how many times its rows changed.
+	NSArray *sectionsWithChangedRows = self.sectionsWithChangedRows;
+	self.sectionsWithChangedRows = nil;
+
+	for( JSMStaticSection *section in sectionsWithChangedRows ) {
+		[section rowsDidChange];
+	}
+
+	// Followed by the data source itself.
+	if( self.sectionsChangedDuringBatch ) {
+		self.sectionsChangedDuringBatch = NO;
+		[self sectionsDidChange];
+	}
+}
+
+- (void)sectionDidChangeRowsDuringBatch:(JSMStaticSection *)section {
+	if( self.sectionsWithChangedRows == nil ) {
+		self.sectionsWithChangedRows = [NSMutableArray array];
+	}
+	else if( [self.sectionsWithChangedRows indexOfObjectIdenticalTo:section] != NSNotFound ) {
+		return;
+	}
+
+	[self.sectionsWithChangedRows addObject:section];
+}
+
 #pragma mark - Refreshing the Contents
 
 - (void)requestReloadForSection:(JSMStaticSection *)section {
@@ -338,6 +641,7 @@ static Class _staticCellClass = nil;
 - (NSInteger)numberOfSectionsInTableView:(UITableView *)tableView {
     // Store a link to the table view
     _tableView = tableView;
+    [self registerCellClassesWithTableView:tableView];
 
     // Return the number of sections
     return self.numberOfSections;
@@ -358,47 +662,16 @@ static Class _staticCellClass = nil;
 }
 
 - (UITableViewCell *)tableView:(UITableView *)tableView dequeueReusableCellForRow:(JSMStaticRow *)row {
-    UITableViewCell *cell;
-	Class cellClass;
 	// Get the cell class
-	if( row.cellClass != nil ) {
-		cellClass = row.cellClass;
-	}
-	else {
-		cellClass = self.cellClass;
-	}
+	Class cellClass = row.cellClass != nil ? row.cellClass : self.cellClass;
 	// Get the cell style
-	switch( row.style ) {
-        case UITableViewCellStyleDefault: {
-			NSString *reuseIdentifier = [NSString stringWithFormat:@"JSMStaticDataSourceDefaultReuseIdentifier.%@", cellClass];
-            if( ( cell = [tableView dequeueReusableCellWithIdentifier:reuseIdentifier] ) == nil ) {
-                cell = [[cellClass alloc] initWithStyle:UITableViewCellStyleDefault reuseIdentifier:reuseIdentifier];
-            }
-            break;
-        }
-        case UITableViewCellStyleValue1:
-        default: {
-            NSString *reuseIdentifier = [NSString stringWithFormat:@"JSMStaticDataSourceValue1ReuseIdentifier.%@", cellClass];
-            if( ( cell = [tableView dequeueReusableCellWithIdentifier:reuseIdentifier] ) == nil ) {
-                cell = [[cellClass alloc] initWithStyle:UITableViewCellStyleValue1 reuseIdentifier:reuseIdentifier];
-            }
-            break;
-        }
-        case UITableViewCellStyleValue2: {
-            NSString *reuseIdentifier = [NSString stringWithFormat:@"JSMStaticDataSourceValue2ReuseIdentifier.%@", cellClass];
-            if( ( cell = [tableView dequeueReusableCellWithIdentifier:reuseIdentifier] ) == nil ) {
-                cell = [[cellClass alloc] initWithStyle:UITableViewCellStyleValue2 reuseIdentifier:reuseIdentifier];
-            }
-            break;
-        }
-        case UITableViewCellStyleSubtitle: {
-            NSString *reuseIdentifier = [NSString stringWithFormat:@"JSMStaticDataSourceSubtitleReuseIdentifier.%@", cellClass];
-            if( ( cell = [tableView dequeueReusableCellWithIdentifier:reuseIdentifier] ) == nil ) {
-                cell = [[cellClass alloc] initWithStyle:UITableViewCellStyleSubtitle reuseIdentifier:reuseIdentifier];
-            }
-            break;
-        }
-    }
+	UITableViewCellStyle style = [self.class normalizedCellStyle:row.style];
+	// Registered classes are always returned by the table view, otherwise we may have to create one.
+	NSString *reuseIdentifier = [self.class reuseIdentifierForCellClass:cellClass style:style];
+	UITableViewCell *cell = [tableView dequeueReusableCellWithIdentifier:reuseIdentifier];
+	if( cell == nil ) {
+		cell = [[cellClass alloc] initWithStyle:style reuseIdentifier:reuseIdentifier];
+	}
     // Return the cell
     return cell;
 }
@@ -408,8 +681,37 @@ static Class _staticCellClass = nil;
 	JSMStaticRow *row = [self rowAtIndexPath:indexPath];
 	// Get a cell
 	UITableViewCell *cell = [self tableView:tableView dequeueReusableCellForRow:row];
-	// Remove invalid subviews
-	if (row.cellClass == nil) {
+	// Configure the cell using the row's configuration block
+	[self prepareCell:cell forRow:row];
+	// Return the cell
+	return cell;
+}
+
+#pragma mark - Table View Data Source Prefetching
+
+- (void)tableView:(UITableView *)tableView prefetchRowsAtIndexPaths:(NSArray<NSIndexPath *> *)indexPaths {
+	// Images are the only content expensive enough to be worth preparing ahead of time
+	for( NSIndexPath *indexPath in indexPaths ) {
+		[[self rowAtIndexPath:indexPath] prefetchImage];
+	}
+}
+
+- (void)tableView:(UITableView *)tableView cancelPrefetchingForRowsAtIndexPaths:(NSArray<NSIndexPath *> *)indexPaths {
+	for( NSIndexPath *indexPath in indexPaths ) {
+		[[self rowAtIndexPath:indexPath] cancelPrefetchingImage];
+	}
+}
+
+#pragma mark - Configuring Cells
+
+- (void)prepareCell:(UITableViewCell *)cell forRow:(JSMStaticRow *)row {
+	JSMStaticCellConfiguration *configuration = [self.cellConfigurations objectForKey:cell];
+	if( configuration == nil ) {
+		configuration = [JSMStaticCellConfiguration new];
+		[self.cellConfigurations setObject:configuration forKey:cell];
+	}
+	// Remove subviews left behind by a custom row
+	else if( configuration.customContent && row.cellClass == nil ) {
 		for(UIView *subview in cell.contentView.subviews) {
 			if( [subview isEqual:cell.textLabel] ) continue;
 			if( [subview isEqual:cell.detailTextLabel] ) continue;
@@ -417,10 +719,81 @@ static Class _staticCellClass = nil;
 			[subview removeFromSuperview];
 		}
 	}
-	// Configure the cell using the row's configuration block
+
 	[row prepareCell:cell];
-	// Return the cell
-	return cell;
+
+	configuration.row = row;
+	configuration.generation = row.contentGeneration;
+	configuration.customContent = row.hasCustomContent;
+}
+
+- (void)prepareCellIfNeeded:(UITableViewCell *)cell forRow:(JSMStaticRow *)row {
+	JSMStaticCellConfiguration *configuration = [self.cellConfigurations objectForKey:cell];
+	if( configuration != nil && configuration.row == row && configuration.generation == row.contentGeneration ) {
+		return;
+	}
+
+	[self prepareCell:cell forRow:row];
+}
+
+- (void)invalidateConfigurationForCell:(UITableViewCell *)cell {
+	JSMStaticCellConfiguration *configuration = [self.cellConfigurations objectForKey:cell];
+	configuration.row = nil;
+}
+
+#pragma mark - Tracking Visible Cells
+
+- (BOOL)tracksVisibleCells {
+	return self.visibleCellsByRow != nil;
+}
+
+- (UITableViewCell *)visibleCellForRow:(JSMStaticRow *)row {
+	return [self.visibleCellsByRow objectForKey:row];
+}
+
+- (void)willDisplayCell:(UITableViewCell *)cell forRow:(JSMStaticRow *)row {
+	if( self.visibleCellsByRow == nil ) {
+		// Rows compare by content, so they need to be tracked by identity
+		self.visibleCellsByRow = [[NSMapTable alloc] initWithKeyOptions:NSPointerFunctionsWeakMemory|NSPointerFunctionsObjectPointerPersonality valueOptions:NSPointerFunctionsWeakMemory capacity:0];
+		self.visibleRowsByCell = [NSMapTable weakToWeakObjectsMapTable];
+	}
+
+	JSMStaticRow *previousRow = [self.visibleRowsByCell objectForKey:cell];
+	if( previousRow != nil && previousRow != row && [self.visibleCellsByRow objectForKey:previousRow] == cell ) {
+		[self.visibleCellsByRow removeObjectForKey:previousRow];
+	}
+
+	[self.visibleCellsByRow setObject:cell forKey:row];
+	[self.visibleRowsByCell setObject:row forKey:cell];
+}
+
+- (void)replaceVisibleRow:(JSMStaticRow *)row withRow:(JSMStaticRow *)replacementRow {
+	UITableViewCell *cell = [self.visibleCellsByRow objectForKey:row];
+	if( cell == nil || row == replacementRow ) {
+		return;
+	}
+
+	// The cell stays on screen without being reloaded, so it needs to show the replacement from now on
+	[self.visibleCellsByRow removeObjectForKey:row];
+	[self.visibleCellsByRow setObject:cell forKey:replacementRow];
+	[self.visibleRowsByCell setObject:replacementRow forKey:cell];
+	[self prepareCell:cell forRow:replacementRow];
+}
+
+- (JSMStaticRow *)didEndDisplayingCell:(UITableViewCell *)cell {
+	JSMStaticRow *row = [self.visibleRowsByCell objectForKey:cell];
+	if( row == nil ) {
+		return nil;
+	}
+
+	[self.visibleRowsByCell removeObjectForKey:cell];
+
+	// The row may already be displayed by another cell, such as while it is being reloaded.
+	if( [self.visibleCellsByRow objectForKey:row] == cell ) {
+		[self.visibleCellsByRow removeObjectForKey:row];
+	}
+
+	return row;
 }
 
 - (BOOL)tableView:(UITableView *)tableView canMoveRowAtIndexPath:(NSIndexPath *)indexPath {
@@ -482,3 +855,7 @@ static Class _staticCellClass = nil;
 }
 
 @end
+
+@implementation JSMStaticCellConfiguration
+
+@end
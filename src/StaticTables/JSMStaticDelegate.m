@@ -30,28 +30,117 @@
 
 @end
 
-@implementation JSMStaticDelegate
+typedef NS_OPTIONS(NSUInteger, JSMStaticDelegateRoute) {
+	JSMStaticDelegateRouteNone = 0,
+	JSMStaticDelegateRouteOverride = 1 << 0,
+	JSMStaticDelegateRouteInternal = 1 << 1,
+	JSMStaticDelegateRouteCached = 1 << 2,
+};
+
+@implementation JSMStaticDelegate {
+	CFMutableDictionaryRef _routes;
+}
+
+@synthesize internalDelegate = _internalDelegate;
+@synthesize overrideDelegate = _overrideDelegate;
+
+- (void)dealloc {
+	if( _routes != NULL ) {
+		CFRelease(_routes);
+	}
+}
+
+#pragma mark - Delegates
+
+- (void)setInternalDelegate:(id<UITableViewDelegate>)internalDelegate {
+	_internalDelegate = internalDelegate;
+	[self invalidateRoutes];
+}
+
+- (void)setOverrideDelegate:(id<UITableViewDelegate>)overrideDelegate {
+	_overrideDelegate = overrideDelegate;
+	[self invalidateRoutes];
+}
+
+#pragma mark - Routing
+
+- (void)invalidateRoutes {
+	if( _routes != NULL ) {
+		CFDictionaryRemoveAllValues(_routes);
+	}
+}
+
+// Determine which delegates a selector should be sent to, which is cached until the delegates change.
+- (JSMStaticDelegateRoute)routeForSelector:(SEL)aSelector {
+	if( _routes == NULL ) {
+		_routes = CFDictionaryCreateMutable(kCFAllocatorDefault, 0, NULL, NULL);
+	}
+
+	JSMStaticDelegateRoute route = (JSMStaticDelegateRoute)(uintptr_t)CFDictionaryGetValue(_routes, aSelector);
+	if( route & JSMStaticDelegateRouteCached ) {
+		route &= ~JSMStaticDelegateRouteCached;
+
+		// Delegates are held weakly, so one of them may have been deallocated without being cleared.
+		BOOL overrideMissing = ( route & JSMStaticDelegateRouteOverride ) && self.overrideDelegate == nil;
+		BOOL internalMissing = ( route & JSMStaticDelegateRouteInternal ) && self.internalDelegate == nil;
+		if( ! overrideMissing && ! internalMissing ) {
+			return route;
+		}
+
+		[self invalidateRoutes];
+	}
+
+	route = JSMStaticDelegateRouteNone;
+
+	id<UITableViewDelegate> overrideDelegate = self.overrideDelegate;
+	if( overrideDelegate != nil && [overrideDelegate respondsToSelector:aSelector] ) {
+		route |= JSMStaticDelegateRouteOverride;
+	}
+
+	id<UITableViewDelegate> internalDelegate = self.internalDelegate;
+	if( internalDelegate != nil && [internalDelegate respondsToSelector:aSelector] ) {
+		route |= JSMStaticDelegateRouteInternal;
+	}
+
+	// Only methods that return void are sent to both delegates, otherwise the override delegate wins.
+	if( route == ( JSMStaticDelegateRouteOverride | JSMStaticDelegateRouteInternal ) && [(NSObject *)overrideDelegate methodSignatureForSelector:aSelector].methodReturnLength > 0 ) {
+		route = JSMStaticDelegateRouteOverride;
+	}
+
+	CFDictionarySetValue(_routes, aSelector, (const void *)(uintptr_t)(route | JSMStaticDelegateRouteCached));
+
+	return route;
+}
+
+#pragma mark - Forwarding
 
 - (BOOL)conformsToProtocol:(Protocol *)aProtocol {
 	return [self.overrideDelegate conformsToProtocol:aProtocol] || [self.internalDelegate conformsToProtocol:aProtocol];
 }
 
 - (BOOL)respondsToSelector:(SEL)aSelector {
-	if( self.overrideDelegate != nil && [self.overrideDelegate respondsToSelector:aSelector] ) {
-		return true;
-	}
-	else if( self.internalDelegate != nil && [self.internalDelegate respondsToSelector:aSelector] ) {
-		return true;
-	}
+	return [self routeForSelector:aSelector] != JSMStaticDelegateRouteNone;
+}
 
-	return false;
+// When only one delegate needs the message, the runtime can send it straight there without building an invocation.
+- (id)forwardingTargetForSelector:(SEL)aSelector {
+	switch( [self routeForSelector:aSelector] ) {
+		case JSMStaticDelegateRouteOverride:
+			return self.overrideDelegate;
+		case JSMStaticDelegateRouteInternal:
+			return self.internalDelegate;
+		default:
+			return nil;
+	}
 }
 
 - (NSMethodSignature *)methodSignatureForSelector:(SEL)aSelector {
-	if( self.overrideDelegate != nil && [self.overrideDelegate respondsToSelector:aSelector] ) {
+	JSMStaticDelegateRoute route = [self routeForSelector:aSelector];
+
+	if( ( route & JSMStaticDelegateRouteOverride ) && self.overrideDelegate != nil ) {
 		return [(NSObject *)self.overrideDelegate methodSignatureForSelector:aSelector];
 	}
-	else if( self.internalDelegate != nil && [self.internalDelegate respondsToSelector:aSelector] ) {
+	else if( ( route & JSMStaticDelegateRouteInternal ) && self.internalDelegate != nil ) {
 		return [(NSObject *)self.internalDelegate methodSignatureForSelector:aSelector];
 	}
 
@@ -61,26 +150,60 @@
 }
 
 - (void)forwardInvocation:(NSInvocation *)anInvocation {
-	NSMutableArray <id<UITableViewDelegate>> *delegates = [NSMutableArray arrayWithCapacity:2];
+	JSMStaticDelegateRoute route = [self routeForSelector:anInvocation.selector];
 
-	if( self.overrideDelegate != nil && [self.overrideDelegate respondsToSelector:anInvocation.selector] ) {
-		[delegates addObject:self.overrideDelegate];
+	if( route == JSMStaticDelegateRouteNone ) {
+		[super forwardInvocation:anInvocation];
+		return;
 	}
 
-	if( self.internalDelegate != nil && [self.internalDelegate respondsToSelector:anInvocation.selector] ) {
-		[delegates addObject:self.internalDelegate];
+	if( route & JSMStaticDelegateRouteOverride ) {
+		[anInvocation invokeWithTarget:self.overrideDelegate];
 	}
 
-	if( delegates.count == 0 ) {
-		[super forwardInvocation:anInvocation];
+	if( route & JSMStaticDelegateRouteInternal ) {
+		[anInvocation invokeWithTarget:self.internalDelegate];
+	}
+}
+
+#pragma mark - Trampolines
+
+// Methods that are called for every row or scroll event, and that both delegates commonly implement, are sent directly
+// rather than through an invocation.
+
+- (void)tableView:(UITableView *)tableView willDisplayCell:(UITableViewCell *)cell forRowAtIndexPath:(NSIndexPath *)indexPath {
+	JSMStaticDelegateRoute route = [self routeForSelector:_cmd];
+
+	if( route & JSMStaticDelegateRouteOverride ) {
+		[self.overrideDelegate tableView:tableView willDisplayCell:cell forRowAtIndexPath:indexPath];
 	}
-	else if( anInvocation.methodSignature.methodReturnLength > 0 ) {
-		[anInvocation invokeWithTarget:delegates.firstObject];
+
+	if( route & JSMStaticDelegateRouteInternal ) {
+		[self.internalDelegate tableView:tableView willDisplayCell:cell forRowAtIndexPath:indexPath];
 	}
-	else {
-		for( id<UITableViewDelegate> delegate in delegates ) {
-			[anInvocation invokeWithTarget:delegate];
-		}
+}
+
+- (void)tableView:(UITableView *)tableView didEndDisplayingCell:(UITableViewCell *)cell forRowAtIndexPath:(NSIndexPath *)indexPath {
+	JSMStaticDelegateRoute route = [self routeForSelector:_cmd];
+
+	if( route & JSMStaticDelegateRouteOverride ) {
+		[self.overrideDelegate tableView:tableView didEndDisplayingCell:cell forRowAtIndexPath:indexPath];
+	}
+
+	if( route & JSMStaticDelegateRouteInternal ) {
+		[self.internalDelegate tableView:tableView didEndDisplayingCell:cell forRowAtIndexPath:indexPath];
+	}
+}
+
+- (void)scrollViewDidScroll:(UIScrollView *)scrollView {
+	JSMStaticDelegateRoute route = [self routeForSelector:_cmd];
+
+	if( route & JSMStaticDelegateRouteOverride ) {
+		[self.overrideDelegate scrollViewDidScroll:scrollView];
+	}
+
+	if( route & JSMStaticDelegateRouteInternal ) {
+		[self.internalDelegate scrollViewDidScroll:scrollView];
 	}
 }
 
@@ -0,0 +1,109 @@
+//
+// Copyright © 2019 Daniel Farrelly
+//
+// Redistribution and use in source and binary forms, with or without modification,
+// are permitted provided that the following conditions are met:
+//
+// *	Redistributions of source code must retain the above copyright notice, this list
+//		of conditions and the following disclaimer.
+// *	Redistributions in binary form must reproduce the above copyright notice, this
+//		list of conditions and the following disclaimer in the documentation and/or
+//		other materials provided with the distribution.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+// ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+// WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+// IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+// INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+// BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+// DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+// LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE
+// OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+// ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//
+
+@import UIKit;
+
+NS_ASSUME_NONNULL_BEGIN
+
+/**
+ * A `JSMStaticDiff` describes the changes required to transform one collection of `JSMStaticSection` or `JSMStaticRow`
+ * objects into another, in a form that can be applied to a `UITableView` within a single batch update.
+ *
+ * Objects are matched by their `key`, or by identity if they don't have one. Objects that cannot be matched (including
+ * those whose key appears more than once in either collection) are considered to be deleted or inserted. Of the matched
+ * objects, the smallest possible number are considered to have moved, and those whose content may have changed are
+ * considered to need reloading. Because a table view cannot reload an item that is moving, any matched object that both
+ * moved and changed is considered to be deleted and inserted instead.
+ */
+
+@interface JSMStaticDiff : NSObject
+
+///---------------------------------------------
+/// @name Creating Diffs
+///---------------------------------------------
+
+/**
+ * Calculates the changes between two collections of either `JSMStaticSection` or `JSMStaticRow` objects.
+ *
+ * Rows with matching keys are considered to have changed if they have been marked as needing to be reloaded, or if they
+ * are different instances with different content, such as text, images, style, accessories or cell class. Preferences
+ * that are different instances are always considered to have changed, as each has its own control and value. Sections
+ * are considered to have changed if they are not the same instance and their header or footer text differs, or if
+ * they have been marked as needing to be reloaded. The rows within sections are not compared.
+ *
+ * @param oldObjects The original collection of sections or rows.
+ * @param newObjects The updated collection of sections or rows.
+ * @return The new instance of `JSMStaticDiff`.
+ */
+
++ (instancetype)diffFromObjects:(NSArray *)oldObjects toObjects:(NSArray *)newObjects NS_SWIFT_NAME(init(from:to:));
+
+///---------------------------------------------
+/// @name Accessing the Changes
+///---------------------------------------------
+
+/**
+ * The indexes within the original collection of objects that were removed.
+ */
+
+@property (nonatomic, strong, readonly) NSIndexSet *deletedIndexes;
+
+/**
+ * The indexes within the updated collection of objects that were added.
+ */
+
+@property (nonatomic, strong, readonly) NSIndexSet *insertedIndexes;
+
+/**
+ * The indexes within the original collection of objects that were moved.
+ *
+ * The updated index for each can be found using `updatedIndexForIndex:`.
+ */
+
+@property (nonatomic, strong, readonly) NSIndexSet *movedIndexes;
+
+/**
+ * The indexes within the original collection of objects that need to be reloaded.
+ */
+
+@property (nonatomic, strong, readonly) NSIndexSet *reloadedIndexes;
+
+/**
+ * Flag indicating if there are any changes between the two collections.
+ */
+
+@property (nonatomic, readonly) BOOL hasChanges;
+
+/**
+ * Fetch the index within the updated collection of the object at the given index of the original collection.
+ *
+ * @param index The index of an object within the original collection.
+ * @return The index of the matching object within the updated collection, or `NSNotFound` if it was deleted.
+ */
+
+- (NSUInteger)updatedIndexForIndex:(NSUInteger)index NS_SWIFT_NAME(updatedIndex(for:));
+
+@end
+
+NS_ASSUME_NONNULL_END
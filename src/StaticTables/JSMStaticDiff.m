@@ -0,0 +1,271 @@
+//
+// Copyright © 2019 Daniel Farrelly
+//
+// Redistribution and use in source and binary forms, with or without modification,
+// are permitted provided that the following conditions are met:
+//
+// *	Redistributions of source code must retain the above copyright notice, this list
+//		of conditions and the following disclaimer.
+// *	Redistributions in binary form must reproduce the above copyright notice, this
+//		list of conditions and the following disclaimer in the documentation and/or
+//		other materials provided with the distribution.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+// ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+// WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+// IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+// INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+// BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+// DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+// LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE
+// OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+// ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//
+
+#import "JSMStaticDiff.h"
+#import "JSMStaticSection.h"
+#import "JSMStaticRow.h"
+#import "JSMStaticPreference.h"
+
+typedef struct {
+	NSUInteger originalCount;
+	NSUInteger updatedCount;
+	NSUInteger originalIndex;
+} JSMStaticDiffEntry;
+
+@interface JSMStaticDiff ()
+
+@property (nonatomic, strong, readwrite) NSIndexSet *deletedIndexes;
+
+@property (nonatomic, strong, readwrite) NSIndexSet *insertedIndexes;
+
+@property (nonatomic, strong, readwrite) NSIndexSet *movedIndexes;
+
+@property (nonatomic, strong, readwrite) NSIndexSet *reloadedIndexes;
+
+@property (nonatomic, strong) NSData *updatedIndexes;
+
+@end
+
+@interface JSMStaticRow (JSMStaticDiff)
+
+- (BOOL)hasSameContentAsRow:(JSMStaticRow *)row;
+
+@end
+
+@implementation JSMStaticDiff
+
+#pragma mark - Creating Diffs
+
++ (instancetype)diffFromObjects:(NSArray *)oldObjects toObjects:(NSArray *)newObjects {
+	return [[self alloc] initWithOriginalObjects:oldObjects updatedObjects:newObjects];
+}
+
+- (instancetype)initWithOriginalObjects:(NSArray *)originalObjects updatedObjects:(NSArray *)updatedObjects {
+	if( ( self = [super init] ) ) {
+		NSUInteger originalCount = originalObjects.count;
+		NSUInteger updatedCount = updatedObjects.count;
+
+		// Count how many times each identifier appears in both collections. Only the identifiers that appear exactly once
+		// in each can be matched up.
+		NSMapTable *entryIndexes = [NSMapTable strongToStrongObjectsMapTable];
+		NSMutableData *entries = [NSMutableData data];
+		NSMutableData *updatedEntryIndexes = [NSMutableData dataWithLength:sizeof(NSUInteger) * updatedCount];
+
+		for( NSUInteger i = 0; i < originalCount; i++ ) {
+			NSUInteger entryIndex = [self entryIndexForObject:originalObjects[i] entryIndexes:entryIndexes entries:entries];
+			JSMStaticDiffEntry *entry = (JSMStaticDiffEntry *)entries.mutableBytes + entryIndex;
+			entry->originalCount += 1;
+			entry->originalIndex = i;
+		}
+
+		for( NSUInteger j = 0; j < updatedCount; j++ ) {
+			NSUInteger entryIndex = [self entryIndexForObject:updatedObjects[j] entryIndexes:entryIndexes entries:entries];
+			JSMStaticDiffEntry *entry = (JSMStaticDiffEntry *)entries.mutableBytes + entryIndex;
+			entry->updatedCount += 1;
+			((NSUInteger *)updatedEntryIndexes.mutableBytes)[j] = entryIndex;
+		}
+
+		// Match the objects up in both directions.
+		NSMutableData *updatedIndexes = [NSMutableData dataWithLength:sizeof(NSUInteger) * originalCount];
+		NSMutableData *originalIndexes = [NSMutableData dataWithLength:sizeof(NSUInteger) * updatedCount];
+		NSUInteger *originalToUpdated = updatedIndexes.mutableBytes;
+		NSUInteger *updatedToOriginal = originalIndexes.mutableBytes;
+		JSMStaticDiffEntry *entryValues = entries.mutableBytes;
+
+		for( NSUInteger i = 0; i < originalCount; i++ ) {
+			originalToUpdated[i] = NSNotFound;
+		}
+
+		NSUInteger matchedCount = 0;
+		for( NSUInteger j = 0; j < updatedCount; j++ ) {
+			JSMStaticDiffEntry entry = entryValues[((NSUInteger *)updatedEntryIndexes.mutableBytes)[j]];
+			if( entry.originalCount == 1 && entry.updatedCount == 1 ) {
+				updatedToOriginal[j] = entry.originalIndex;
+				originalToUpdated[entry.originalIndex] = j;
+				matchedCount += 1;
+			}
+			else {
+				updatedToOriginal[j] = NSNotFound;
+			}
+		}
+
+		// The longest run of matched objects that retain their order don't need to move; everything else does.
+		NSMutableData *stationary = [self stationaryFlagsForUpdatedToOriginal:updatedToOriginal count:updatedCount matchedCount:matchedCount];
+		BOOL *isStationary = stationary.mutableBytes;
+
+		NSMutableIndexSet *deletedIndexes = [NSMutableIndexSet indexSet];
+		NSMutableIndexSet *insertedIndexes = [NSMutableIndexSet indexSet];
+		NSMutableIndexSet *movedIndexes = [NSMutableIndexSet indexSet];
+		NSMutableIndexSet *reloadedIndexes = [NSMutableIndexSet indexSet];
+
+		for( NSUInteger i = 0; i < originalCount; i++ ) {
+			if( originalToUpdated[i] == NSNotFound ) {
+				[deletedIndexes addIndex:i];
+			}
+		}
+
+		NSUInteger k = 0;
+		for( NSUInteger j = 0; j < updatedCount; j++ ) {
+			NSUInteger i = updatedToOriginal[j];
+			if( i == NSNotFound ) {
+				[insertedIndexes addIndex:j];
+				continue;
+			}
+
+			BOOL changed = [self.class originalObject:originalObjects[i] differsFromUpdatedObject:updatedObjects[j]];
+			if( isStationary[k++] ) {
+				if( changed ) {
+					[reloadedIndexes addIndex:i];
+				}
+			}
+			// Table views can't reload an item that is also moving, so we replace it instead.
+			else if( changed ) {
+				[deletedIndexes addIndex:i];
+				[insertedIndexes addIndex:j];
+				originalToUpdated[i] = NSNotFound;
+			}
+			else {
+				[movedIndexes addIndex:i];
+			}
+		}
+
+		_deletedIndexes = deletedIndexes.copy;
+		_insertedIndexes = insertedIndexes.copy;
+		_movedIndexes = movedIndexes.copy;
+		_reloadedIndexes = reloadedIndexes.copy;
+		_updatedIndexes = updatedIndexes;
+	}
+	return self;
+}
+
+- (NSUInteger)entryIndexForObject:(id)object entryIndexes:(NSMapTable *)entryIndexes entries:(NSMutableData *)entries {
+	id identifier = [(JSMStaticRow *)object key] ?: [NSValue valueWithNonretainedObject:object];
+
+	NSNumber *entryIndex = [entryIndexes objectForKey:identifier];
+	if( entryIndex != nil ) {
+		return entryIndex.unsignedIntegerValue;
+	}
+
+	NSUInteger index = entries.length / sizeof(JSMStaticDiffEntry);
+	JSMStaticDiffEntry entry = { 0, 0, NSNotFound };
+	[entries appendBytes:&entry length:sizeof(JSMStaticDiffEntry)];
+	[entryIndexes setObject:@(index) forKey:identifier];
+	return index;
+}
+
+// Finds the longest increasing subsequence of original indexes (in the order they appear in the updated collection)
+// using patience sorting, and returns a flag for each matched object indicating if it is part of that subsequence.
+- (NSMutableData *)stationaryFlagsForUpdatedToOriginal:(NSUInteger *)updatedToOriginal count:(NSUInteger)count matchedCount:(NSUInteger)matchedCount {
+	NSMutableData *stationary = [NSMutableData dataWithLength:sizeof(BOOL) * matchedCount];
+	if( matchedCount == 0 ) {
+		return stationary;
+	}
+
+	NSMutableData *sequenceData = [NSMutableData dataWithLength:sizeof(NSUInteger) * matchedCount];
+	NSMutableData *tailsData = [NSMutableData dataWithLength:sizeof(NSUInteger) * matchedCount];
+	NSMutableData *predecessorsData = [NSMutableData dataWithLength:sizeof(NSUInteger) * matchedCount];
+	NSUInteger *sequence = sequenceData.mutableBytes;
+	NSUInteger *tails = tailsData.mutableBytes;
+	NSUInteger *predecessors = predecessorsData.mutableBytes;
+
+	NSUInteger k = 0;
+	for( NSUInteger j = 0; j < count; j++ ) {
+		if( updatedToOriginal[j] != NSNotFound ) {
+			sequence[k++] = updatedToOriginal[j];
+		}
+	}
+
+	NSUInteger length = 0;
+	for( k = 0; k < matchedCount; k++ ) {
+		NSUInteger low = 0;
+		NSUInteger high = length;
+		while( low < high ) {
+			NSUInteger middle = ( low + high ) / 2;
+			if( sequence[tails[middle]] < sequence[k] ) {
+				low = middle + 1;
+			}
+			else {
+				high = middle;
+			}
+		}
+
+		predecessors[k] = low > 0 ? tails[low - 1] : NSNotFound;
+		tails[low] = k;
+		if( low == length ) {
+			length += 1;
+		}
+	}
+
+	BOOL *isStationary = stationary.mutableBytes;
+	for( k = tails[length - 1]; k != NSNotFound; k = predecessors[k] ) {
+		isStationary[k] = YES;
+	}
+
+	return stationary;
+}
+
++ (BOOL)originalObject:(id)originalObject differsFromUpdatedObject:(id)updatedObject {
+	if( [updatedObject isKindOfClass:[JSMStaticSection class]] ) {
+		JSMStaticSection *originalSection = (JSMStaticSection *)originalObject;
+		JSMStaticSection *updatedSection = (JSMStaticSection *)updatedObject;
+
+		if( updatedSection.needsReload ) {
+			return YES;
+		}
+		else if( originalSection == updatedSection ) {
+			return NO;
+		}
+
+		BOOL haveEqualHeaderText = ( ! originalSection.headerText && ! updatedSection.headerText ) || [originalSection.headerText isEqualToString:updatedSection.headerText];
+		BOOL haveEqualFooterText = ( ! originalSection.footerText && ! updatedSection.footerText ) || [originalSection.footerText isEqualToString:updatedSection.footerText];
+		return ! haveEqualHeaderText || ! haveEqualFooterText;
+	}
+
+	JSMStaticRow *originalRow = (JSMStaticRow *)originalObject;
+	JSMStaticRow *updatedRow = (JSMStaticRow *)updatedObject;
+
+	// Preferences own their control, so a replacement needs its own cell
+	if( originalRow != updatedRow && [updatedRow isKindOfClass:[JSMStaticPreference class]] ) {
+		return YES;
+	}
+
+	// Replacement rows with the same key, such as those in a layout that has been rebuilt, only change if they look different.
+	return updatedRow.needsReload || ! [originalRow hasSameContentAsRow:updatedRow];
+}
+
+#pragma mark - Accessing the Changes
+
+- (BOOL)hasChanges {
+	return self.deletedIndexes.count > 0 || self.insertedIndexes.count > 0 || self.movedIndexes.count > 0 || self.reloadedIndexes.count > 0;
+}
+
+- (NSUInteger)updatedIndexForIndex:(NSUInteger)index {
+	if( index >= self.updatedIndexes.length / sizeof(NSUInteger) ) {
+		return NSNotFound;
+	}
+
+	return ((const NSUInteger *)self.updatedIndexes.bytes)[index];
+}
+
+@end
@@ -0,0 +1,63 @@
+//
+// Copyright © 2019 Daniel Farrelly
+//
+// Redistribution and use in source and binary forms, with or without modification,
+// are permitted provided that the following conditions are met:
+//
+// *	Redistributions of source code must retain the above copyright notice, this list
+//		of conditions and the following disclaimer.
+// *	Redistributions in binary form must reproduce the above copyright notice, this
+//		list of conditions and the following disclaimer in the documentation and/or
+//		other materials provided with the distribution.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+// ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+// WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+// IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+// INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+// BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+// DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+// LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE
+// OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+// ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//
+
+@import Foundation;
+#import "JSMStaticSelectOption.h"
+
+NS_ASSUME_NONNULL_BEGIN
+
+/**
+ * A `JSMStaticFileOptionSource` provides the options for a `JSMStaticSelectPreference` from a text file, which is
+ * memory mapped rather than read into memory.
+ *
+ * The file should be UTF-8 encoded, with one option on each line. Each line contains the option's value, optionally
+ * followed by its label and image name, separated by tabs. Empty lines are ignored.
+ *
+ * Only the position of each line is kept in memory. Options are created from the file as they're requested, and values
+ * are looked up through an index of their hashes, which is built the first time one is needed.
+ */
+
+@interface JSMStaticFileOptionSource : NSObject <JSMStaticSelectOptionSource>
+
+/**
+ * Initialises a new instance of `JSMStaticFileOptionSource` with the options in the file at the given URL.
+ *
+ * @param fileURL The location of the file containing the options.
+ * @param error If the file can't be read, upon return contains an error describing the problem.
+ * @return A new instance of `JSMStaticFileOptionSource`, or nil if the file couldn't be read.
+ */
+
+- (nullable instancetype)initWithFileURL:(NSURL *)fileURL error:(NSError **)error NS_DESIGNATED_INITIALIZER;
+
+- (instancetype)init NS_UNAVAILABLE;
+
+/**
+ * The location of the file the reciever provides options from.
+ */
+
+@property (nonatomic, strong, readonly) NSURL *fileURL;
+
+@end
+
+NS_ASSUME_NONNULL_END
@@ -0,0 +1,216 @@
+//
+// Copyright © 2019 Daniel Farrelly
+//
+// Redistribution and use in source and binary forms, with or without modification,
+// are permitted provided that the following conditions are met:
+//
+// *	Redistributions of source code must retain the above copyright notice, this list
+//		of conditions and the following disclaimer.
+// *	Redistributions in binary form must reproduce the above copyright notice, this
+//		list of conditions and the following disclaimer in the documentation and/or
+//		other materials provided with the distribution.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+// ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+// WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+// IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+// INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+// BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+// DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+// LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE
+// OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+// ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//
+
+#import "JSMStaticFileOptionSource.h"
+
+typedef struct {
+    uint64_t hash;
+    NSUInteger index;
+} JSMStaticFileOptionValueHash;
+
+static uint64_t JSMStaticFileOptionHashBytes( const char *bytes, NSUInteger length ) {
+    // FNV-1a
+    uint64_t hash = 14695981039346656037ULL;
+    for( NSUInteger i = 0; i < length; i++ ) {
+        hash ^= (uint8_t)bytes[i];
+        hash *= 1099511628211ULL;
+    }
+    return hash;
+}
+
+static int JSMStaticFileOptionCompareValueHashes( const void *a, const void *b ) {
+    const JSMStaticFileOptionValueHash *first = a;
+    const JSMStaticFileOptionValueHash *second = b;
+    if( first->hash != second->hash ) {
+        return first->hash < second->hash ? -1 : 1;
+    }
+    if( first->index != second->index ) {
+        return first->index < second->index ? -1 : 1;
+    }
+    return 0;
+}
+
+@interface JSMStaticFileOptionSource ()
+
+@property (nonatomic, strong) NSData *data;
+
+@property (nonatomic, strong) NSData *lineRanges;
+
+@property (nonatomic, strong) NSData *valueHashes;
+
+@end
+
+@implementation JSMStaticFileOptionSource
+
+- (instancetype)initWithFileURL:(NSURL *)fileURL error:(NSError **)error {
+    NSData *data = [NSData dataWithContentsOfURL:fileURL options:NSDataReadingMappedIfSafe error:error];
+    if( data == nil ) {
+        return nil;
+    }
+
+    if( ( self = [super init] ) ) {
+        _fileURL = fileURL;
+        _data = data;
+        _lineRanges = [self.class lineRangesInData:data];
+    }
+    return self;
+}
+
++ (NSData *)lineRangesInData:(NSData *)data {
+    NSMutableData *lineRanges = [NSMutableData data];
+    const char *bytes = data.bytes;
+    NSUInteger length = data.length;
+
+    NSUInteger start = 0;
+    while( start < length ) {
+        const char *newline = memchr( bytes + start, '\n', length - start );
+        NSUInteger end = newline != NULL ? (NSUInteger)( newline - bytes ) : length;
+
+        NSUInteger lineEnd = end;
+        if( lineEnd > start && bytes[lineEnd - 1] == '\r' ) {
+            lineEnd--;
+        }
+
+        if( lineEnd > start ) {
+            NSRange range = NSMakeRange( start, lineEnd - start );
+            [lineRanges appendBytes:&range length:sizeof(NSRange)];
+        }
+
+        start = end + 1;
+    }
+
+    return lineRanges;
+}
+
+#pragma mark - Reading Lines
+
+- (NSRange)rangeOfLineAtIndex:(NSUInteger)index {
+    return ((const NSRange *)self.lineRanges.bytes)[index];
+}
+
+- (NSRange)rangeOfValueInLine:(NSRange)line {
+    const char *bytes = self.data.bytes;
+    const char *tab = memchr( bytes + line.location, '\t', line.length );
+    return NSMakeRange( line.location, tab != NULL ? (NSUInteger)( tab - bytes ) - line.location : line.length );
+}
+
+- (void)getFields:(NSRange *)fields inLineAtIndex:(NSUInteger)index {
+    NSRange line = [self rangeOfLineAtIndex:index];
+
+    // Split the line into the value, label and image name
+    fields[0] = [self rangeOfValueInLine:line];
+    fields[1] = NSMakeRange( NSMaxRange( line ), 0 );
+    fields[2] = NSMakeRange( NSMaxRange( line ), 0 );
+    for( NSUInteger i = 1; i < 3 && NSMaxRange( fields[i - 1] ) < NSMaxRange( line ); i++ ) {
+        NSUInteger location = NSMaxRange( fields[i - 1] ) + 1;
+        fields[i] = [self rangeOfValueInLine:NSMakeRange( location, NSMaxRange( line ) - location )];
+    }
+}
+
+- (NSString *)stringWithRange:(NSRange)range {
+    if( range.length == 0 ) {
+        return nil;
+    }
+    return [[NSString alloc] initWithBytes:(const char *)self.data.bytes + range.location length:range.length encoding:NSUTF8StringEncoding];
+}
+
+#pragma mark - Providing Options
+
+- (NSUInteger)numberOfOptions {
+    return self.lineRanges.length / sizeof(NSRange);
+}
+
+- (JSMStaticSelectOption *)optionAtIndex:(NSUInteger)index {
+    NSRange fields[3];
+    [self getFields:fields inLineAtIndex:index];
+
+    NSString *value = [self stringWithRange:fields[0]] ?: @"";
+    return [[JSMStaticSelectOption alloc] initWithValue:value label:[self stringWithRange:fields[1]] imageName:[self stringWithRange:fields[2]] index:index];
+}
+
+- (NSString *)labelAtIndex:(NSUInteger)index {
+    NSRange fields[3];
+    [self getFields:fields inLineAtIndex:index];
+
+    // Options without a label use their value
+    return [self stringWithRange:fields[1]] ?: [self stringWithRange:fields[0]] ?: @"";
+}
+
+- (NSUInteger)indexOfOptionWithValue:(id)value {
+    if( ! [value isKindOfClass:[NSString class]] ) {
+        return NSNotFound;
+    }
+
+    if( self.valueHashes == nil ) {
+        [self buildValueHashes];
+    }
+
+    const char *valueBytes = [(NSString *)value UTF8String];
+    NSUInteger valueLength = strlen( valueBytes );
+    uint64_t hash = JSMStaticFileOptionHashBytes( valueBytes, valueLength );
+
+    // Find the first entry with a matching hash
+    const JSMStaticFileOptionValueHash *valueHashes = self.valueHashes.bytes;
+    NSUInteger count = self.valueHashes.length / sizeof(JSMStaticFileOptionValueHash);
+    NSUInteger lower = 0;
+    NSUInteger upper = count;
+    while( lower < upper ) {
+        NSUInteger middle = lower + ( upper - lower ) / 2;
+        if( valueHashes[middle].hash < hash ) {
+            lower = middle + 1;
+        }
+        else {
+            upper = middle;
+        }
+    }
+
+    // Entries with the same hash are ordered by position, so the first match is the first option with the value
+    const char *bytes = self.data.bytes;
+    for( NSUInteger i = lower; i < count && valueHashes[i].hash == hash; i++ ) {
+        NSRange range = [self rangeOfValueInLine:[self rangeOfLineAtIndex:valueHashes[i].index]];
+        if( range.length == valueLength && memcmp( bytes + range.location, valueBytes, valueLength ) == 0 ) {
+            return valueHashes[i].index;
+        }
+    }
+
+    return NSNotFound;
+}
+
+- (void)buildValueHashes {
+    NSUInteger count = self.numberOfOptions;
+    NSMutableData *valueHashes = [NSMutableData dataWithLength:count * sizeof(JSMStaticFileOptionValueHash)];
+    JSMStaticFileOptionValueHash *entries = valueHashes.mutableBytes;
+    const char *bytes = self.data.bytes;
+
+    for( NSUInteger index = 0; index < count; index++ ) {
+        NSRange range = [self rangeOfValueInLine:[self rangeOfLineAtIndex:index]];
+        entries[index].hash = JSMStaticFileOptionHashBytes( bytes + range.location, range.length );
+        entries[index].index = index;
+    }
+
+    qsort( entries, count, sizeof(JSMStaticFileOptionValueHash), JSMStaticFileOptionCompareValueHashes );
+    self.valueHashes = valueHashes;
+}
+
+@end
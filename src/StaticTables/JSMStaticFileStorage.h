@@ -0,0 +1,79 @@
+//
+// Copyright © 2019 Daniel Farrelly
+//
+// Redistribution and use in source and binary forms, with or without modification,
+// are permitted provided that the following conditions are met:
+//
+// *	Redistributions of source code must retain the above copyright notice, this list
+//		of conditions and the following disclaimer.
+// *	Redistributions in binary form must reproduce the above copyright notice, this
+//		list of conditions and the following disclaimer in the documentation and/or
+//		other materials provided with the distribution.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+// ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+// WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+// IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+// INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+// BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+// DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+// LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE
+// OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+// ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//
+
+@import Foundation;
+#import "JSMStaticPreferenceStorage.h"
+
+NS_ASSUME_NONNULL_BEGIN
+
+/**
+ * A `JSMStaticFileStorage` stores preference values in a property list file of its own, which keeps large sets of
+ * preferences out of the user defaults that are loaded when the application launches.
+ *
+ * The file is read the first time a value is requested, and changes are written to it atomically when the storage is
+ * flushed. Values must be property list objects.
+ */
+
+@interface JSMStaticFileStorage : NSObject <JSMStaticPreferenceStorage>
+
+/**
+ * Initialises a new instance of `JSMStaticFileStorage` that stores values in the file at the given URL.
+ *
+ * The file doesn't need to exist yet, but its directory does.
+ *
+ * @param fileURL The location of the file to store values in.
+ * @return A new instance of `JSMStaticFileStorage`.
+ */
+
+- (instancetype)initWithFileURL:(NSURL *)fileURL NS_DESIGNATED_INITIALIZER;
+
+- (instancetype)init NS_UNAVAILABLE;
+
+/**
+ * The location of the file the receiver stores values in.
+ */
+
+@property (nonatomic, strong, readonly) NSURL *fileURL;
+
+/**
+ * Write any changes to the file, reporting an error if they can't be saved.
+ *
+ * This is what `flush` does, but `flush` can only report failures through `lastError`. Changes that fail to save are
+ * kept, and are written the next time the storage is flushed.
+ *
+ * @param error If the changes can't be saved, upon return contains an error describing the problem.
+ * @return Flag indicating if the changes were written, or there were none to write.
+ */
+
+- (BOOL)writeToFileReturningError:(NSError **)error NS_SWIFT_NAME(writeToFile());
+
+/**
+ * The error from the most recent attempt to write to the file, or nil if it succeeded.
+ */
+
+@property (nonatomic, strong, readonly, nullable) NSError *lastError;
+
+@end
+
+NS_ASSUME_NONNULL_END
@@ -0,0 +1,105 @@
+//
+// Copyright © 2019 Daniel Farrelly
+//
+// Redistribution and use in source and binary forms, with or without modification,
+// are permitted provided that the following conditions are met:
+//
+// *	Redistributions of source code must retain the above copyright notice, this list
+//		of conditions and the following disclaimer.
+// *	Redistributions in binary form must reproduce the above copyright notice, this
+//		list of conditions and the following disclaimer in the documentation and/or
+//		other materials provided with the distribution.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+// ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+// WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+// IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+// INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+// BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+// DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+// LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE
+// OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+// ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//
+
+#import "JSMStaticFileStorage.h"
+
+@interface JSMStaticFileStorage ()
+
+@property (nonatomic, strong) NSMutableDictionary<NSString *, id> *values;
+
+@property (nonatomic, getter=isDirty) BOOL dirty;
+
+@property (nonatomic, strong, readwrite) NSError *lastError;
+
+@end
+
+@implementation JSMStaticFileStorage
+
+- (instancetype)initWithFileURL:(NSURL *)fileURL {
+	if( ( self = [super init] ) ) {
+		_fileURL = fileURL;
+	}
+	return self;
+}
+
+- (void)dealloc {
+	[self flush];
+}
+
+#pragma mark - Reading the File
+
+- (NSMutableDictionary<NSString *, id> *)values {
+	if( _values == nil ) {
+		NSData *data = [NSData dataWithContentsOfURL:self.fileURL options:NSDataReadingMappedIfSafe error:nil];
+		id plist = data != nil ? [NSPropertyListSerialization propertyListWithData:data options:NSPropertyListMutableContainers format:NULL error:nil] : nil;
+		_values = [plist isKindOfClass:[NSMutableDictionary class]] ? plist : [NSMutableDictionary dictionary];
+	}
+	return _values;
+}
+
+#pragma mark - Preference Storage
+
+- (NSDictionary<NSString *, id> *)objectsForKeys:(NSArray<NSString *> *)keys {
+	NSMutableDictionary *objects = [NSMutableDictionary dictionaryWithCapacity:keys.count];
+	for( NSString *key in keys ) {
+		objects[key] = self.values[key];
+	}
+	return objects;
+}
+
+- (void)setObjects:(NSDictionary<NSString *, id> *)objects {
+	[objects enumerateKeysAndObjectsUsingBlock:^(NSString *key, id object, BOOL *stop) {
+		self.values[key] = object == [NSNull null] ? nil : object;
+	}];
+	self.dirty = YES;
+}
+
+- (void)flush {
+	[self writeToFileReturningError:nil];
+}
+
+#pragma mark - Writing the File
+
+- (BOOL)writeToFileReturningError:(NSError **)error {
+	if( ! self.isDirty ) {
+		return YES;
+	}
+
+	NSError *writeError = nil;
+	NSData *data = [NSPropertyListSerialization dataWithPropertyList:self.values format:NSPropertyListBinaryFormat_v1_0 options:0 error:&writeError];
+	if( data != nil && [data writeToURL:self.fileURL options:NSDataWritingAtomic error:&writeError] ) {
+		self.dirty = NO;
+		self.lastError = nil;
+		return YES;
+	}
+
+	// The changes are kept so they can be written later
+	self.lastError = writeError;
+	if( error != NULL ) {
+		*error = writeError;
+	}
+	return NO;
+}
+
+@end
@@ -0,0 +1,138 @@
+//
+// Copyright © 2019 Daniel Farrelly
+//
+// Redistribution and use in source and binary forms, with or without modification,
+// are permitted provided that the following conditions are met:
+//
+// *	Redistributions of source code must retain the above copyright notice, this list
+//		of conditions and the following disclaimer.
+// *	Redistributions in binary form must reproduce the above copyright notice, this
+//		list of conditions and the following disclaimer in the documentation and/or
+//		other materials provided with the distribution.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+// ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+// WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+// IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+// INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+// BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+// DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+// LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE
+// OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+// ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//
+
+@import UIKit;
+
+NS_ASSUME_NONNULL_BEGIN
+
+/**
+ * A `JSMStaticImageCache` loads images by name for rows and select options, decoding them on a background queue and
+ * keeping the results in memory.
+ *
+ * Images can be downsampled to the size they're displayed at, so large images only use the memory they need. The
+ * cache evicts the least recently used images once the decoded images it holds exceed `totalCostLimit` bytes, and
+ * empties itself when the application receives a memory warning.
+ *
+ * The cache is intended for use from the main thread, and completion handlers are always called on the main thread.
+ */
+
+@interface JSMStaticImageCache : NSObject
+
+///---------------------------------------------
+/// @name Accessing the Cache
+///---------------------------------------------
+
+/**
+ * The cache used by rows and select options.
+ *
+ * @return The shared instance of `JSMStaticImageCache`.
+ */
+
++ (instancetype)sharedCache NS_SWIFT_NAME(shared());
+
+///---------------------------------------------
+/// @name Managing Memory
+///---------------------------------------------
+
+/**
+ * The maximum number of bytes the decoded images held by the cache may use. Defaults to 16 MB.
+ */
+
+@property (nonatomic) NSUInteger totalCostLimit;
+
+/**
+ * The number of bytes used by the decoded images currently held by the cache.
+ */
+
+@property (nonatomic, readonly) NSUInteger totalCost;
+
+/**
+ * Removes all images from the cache. Images that are being loaded are still delivered to their completion handlers.
+ */
+
+- (void)removeAllImages;
+
+///---------------------------------------------
+/// @name Loading Images
+///---------------------------------------------
+
+/**
+ * Returns an image that has already been decoded, without loading it.
+ *
+ * @param name The name of the image, as passed to `+[UIImage imageNamed:]`.
+ * @param size The size the image was decoded to fit within, or `CGSizeZero` for the original size.
+ * @return The decoded image, or nil if it isn't in the cache.
+ */
+
+- (nullable UIImage *)cachedImageNamed:(NSString *)name size:(CGSize)size NS_SWIFT_NAME(cachedImage(named:size:));
+
+/**
+ * Returns the key an image is stored under in the cache.
+ *
+ * Callers that look up the same image repeatedly, such as a row each time its cell is configured, can build the key
+ * once and pass it to `cachedImageForKey:`.
+ *
+ * @param name The name of the image, as passed to `+[UIImage imageNamed:]`.
+ * @param size The size the image was decoded to fit within, or `CGSizeZero` for the original size.
+ * @return The key for the image.
+ */
+
++ (NSString *)keyForImageNamed:(NSString *)name size:(CGSize)size NS_SWIFT_NAME(key(forImageNamed:size:));
+
+/**
+ * Returns an image that has already been decoded, using a key from `keyForImageNamed:size:`.
+ *
+ * @param key The key for the image.
+ * @return The decoded image, or nil if it isn't in the cache.
+ */
+
+- (nullable UIImage *)cachedImageForKey:(NSString *)key NS_SWIFT_NAME(cachedImage(forKey:));
+
+/**
+ * Loads and decodes an image on a background queue, scaling it down to fit within the given size if it is larger.
+ *
+ * Requests for an image that is already being loaded share the same work. If the image is already in the cache, the
+ * completion handler is called immediately.
+ *
+ * @param name The name of the image, as passed to `+[UIImage imageNamed:]`.
+ * @param size The size to fit the image within, or `CGSizeZero` to keep the original size.
+ * @param completion Block called on the main thread with the decoded image, or nil if it couldn't be loaded.
+ */
+
+- (void)loadImageNamed:(NSString *)name size:(CGSize)size completion:(nullable void(^)(UIImage *_Nullable image))completion NS_SWIFT_NAME(loadImage(named:size:completion:));
+
+/**
+ * Cancels loading an image if it hasn't started decoding and nothing is waiting for it.
+ *
+ * This is intended for prefetching, where the image may turn out not to be needed.
+ *
+ * @param name The name of the image, as passed to `+[UIImage imageNamed:]`.
+ * @param size The size the image was requested to fit within.
+ */
+
+- (void)cancelLoadingImageNamed:(NSString *)name size:(CGSize)size NS_SWIFT_NAME(cancelLoadingImage(named:size:));
+
+@end
+
+NS_ASSUME_NONNULL_END
@@ -0,0 +1,303 @@
+//
+// Copyright © 2019 Daniel Farrelly
+//
+// Redistribution and use in source and binary forms, with or without modification,
+// are permitted provided that the following conditions are met:
+//
+// *	Redistributions of source code must retain the above copyright notice, this list
+//		of conditions and the following disclaimer.
+// *	Redistributions in binary form must reproduce the above copyright notice, this
+//		list of conditions and the following disclaimer in the documentation and/or
+//		other materials provided with the distribution.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+// ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+// WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+// IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+// INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+// BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+// DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+// LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE
+// OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+// ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//
+
+#import "JSMStaticImageCache.h"
+
+@interface JSMStaticImageCacheEntry : NSObject
+
+@property (nonatomic, copy) NSString *key;
+
+@property (nonatomic, strong) UIImage *image;
+
+@property (nonatomic) NSUInteger cost;
+
+@property (nonatomic, weak) JSMStaticImageCacheEntry *previous;
+
+@property (nonatomic, strong) JSMStaticImageCacheEntry *next;
+
+@end
+
+@interface JSMStaticImageCache ()
+
+@property (nonatomic, readwrite) NSUInteger totalCost;
+
+@property (nonatomic, strong) NSMutableDictionary<NSString *, JSMStaticImageCacheEntry *> *entries;
+
+@property (nonatomic, strong) JSMStaticImageCacheEntry *mostRecentEntry;
+
+@property (nonatomic, weak) JSMStaticImageCacheEntry *leastRecentEntry;
+
+@property (nonatomic, strong) NSOperationQueue *decodingQueue;
+
+@property (nonatomic, strong) NSMutableDictionary<NSString *, NSOperation *> *operations;
+
+@property (nonatomic, strong) NSMutableDictionary<NSString *, NSMutableArray *> *completionHandlers;
+
+@end
+
+@implementation JSMStaticImageCache
+
+#pragma mark - Accessing the Cache
+
++ (instancetype)sharedCache {
+    static JSMStaticImageCache *sharedCache = nil;
+    static dispatch_once_t onceToken;
+    dispatch_once(&onceToken, ^{
+        sharedCache = [[self alloc] init];
+    });
+    return sharedCache;
+}
+
+- (instancetype)init {
+    if( ( self = [super init] ) ) {
+        _totalCostLimit = 16 * 1024 * 1024;
+        _entries = [NSMutableDictionary dictionary];
+        _operations = [NSMutableDictionary dictionary];
+        _completionHandlers = [NSMutableDictionary dictionary];
+        _decodingQueue = [NSOperationQueue new];
+        _decodingQueue.name = @"com.jellystyle.StaticTables.JSMStaticImageCache";
+        _decodingQueue.maxConcurrentOperationCount = 2;
+        _decodingQueue.qualityOfService = NSQualityOfServiceUserInitiated;
+
+        [[NSNotificationCenter defaultCenter] addObserver:self selector:@selector(removeAllImages) name:UIApplicationDidReceiveMemoryWarningNotification object:nil];
+    }
+    return self;
+}
+
+- (void)dealloc {
+    [[NSNotificationCenter defaultCenter] removeObserver:self];
+    [self.decodingQueue cancelAllOperations];
+}
+
+#pragma mark - Managing Memory
+
+- (void)setTotalCostLimit:(NSUInteger)totalCostLimit {
+    _totalCostLimit = totalCostLimit;
+    [self evictEntriesIfNeeded];
+}
+
+- (void)removeAllImages {
+    [self.entries removeAllObjects];
+    self.mostRecentEntry = nil;
+    self.leastRecentEntry = nil;
+    self.totalCost = 0;
+}
+
+- (void)evictEntriesIfNeeded {
+    while( self.totalCost > self.totalCostLimit && self.leastRecentEntry != nil ) {
+        JSMStaticImageCacheEntry *entry = self.leastRecentEntry;
+        [self unlinkEntry:entry];
+        [self.entries removeObjectForKey:entry.key];
+        self.totalCost -= entry.cost;
+    }
+}
+
+#pragma mark - Ordering Entries
+
+- (void)unlinkEntry:(JSMStaticImageCacheEntry *)entry {
+    JSMStaticImageCacheEntry *previous = entry.previous;
+    JSMStaticImageCacheEntry *next = entry.next;
+
+    if( previous != nil ) {
+        previous.next = next;
+    }
+    else {
+        self.mostRecentEntry = next;
+    }
+
+    if( next != nil ) {
+        next.previous = previous;
+    }
+    else {
+        self.leastRecentEntry = previous;
+    }
+
+    entry.previous = nil;
+    entry.next = nil;
+}
+
+- (void)moveEntryToFront:(JSMStaticImageCacheEntry *)entry {
+    if( self.mostRecentEntry == entry ) {
+        return;
+    }
+
+    if( entry.previous != nil || entry.next != nil || self.leastRecentEntry == entry ) {
+        [self unlinkEntry:entry];
+    }
+
+    entry.next = self.mostRecentEntry;
+    self.mostRecentEntry.previous = entry;
+    self.mostRecentEntry = entry;
+
+    if( self.leastRecentEntry == nil ) {
+        self.leastRecentEntry = entry;
+    }
+}
+
+#pragma mark - Loading Images
+
++ (NSString *)keyForImageNamed:(NSString *)name size:(CGSize)size {
+    return [NSString stringWithFormat:@"%@|%gx%g",name,size.width,size.height];
+}
+
+- (UIImage *)cachedImageNamed:(NSString *)name size:(CGSize)size {
+    return [self cachedImageForKey:[self.class keyForImageNamed:name size:size]];
+}
+
+- (UIImage *)cachedImageForKey:(NSString *)key {
+    JSMStaticImageCacheEntry *entry = self.entries[key];
+    if( entry == nil ) {
+        return nil;
+    }
+
+    [self moveEntryToFront:entry];
+    return entry.image;
+}
+
+- (void)loadImageNamed:(NSString *)name size:(CGSize)size completion:(void (^)(UIImage *))completion {
+    NSString *key = [self.class keyForImageNamed:name size:size];
+
+    UIImage *cachedImage = [self cachedImageForKey:key];
+    if( cachedImage != nil ) {
+        if( completion != nil ) {
+            completion( cachedImage );
+        }
+        return;
+    }
+
+    if( completion != nil ) {
+        NSMutableArray *completionHandlers = self.completionHandlers[key];
+        if( completionHandlers == nil ) {
+            completionHandlers = [NSMutableArray array];
+            self.completionHandlers[key] = completionHandlers;
+        }
+        [completionHandlers addObject:[completion copy]];
+    }
+
+    // Someone else has already asked for this image
+    if( self.operations[key] != nil ) {
+        return;
+    }
+
+    // The screen scale can't be read from the decoding queue
+    CGFloat scale = UIScreen.mainScreen.scale;
+
+    JSMStaticImageCache __weak *weakSelf = self;
+    NSBlockOperation *operation = [NSBlockOperation new];
+    NSBlockOperation __weak *weakOperation = operation;
+    [operation addExecutionBlock:^{
+        if( weakOperation.isCancelled ) {
+            return;
+        }
+
+        UIImage *image = [JSMStaticImageCache decodedImageNamed:name size:size scale:scale];
+
+        dispatch_async(dispatch_get_main_queue(), ^{
+            [weakSelf finishLoadingImage:image forKey:key operation:weakOperation];
+        });
+    }];
+
+    self.operations[key] = operation;
+    [self.decodingQueue addOperation:operation];
+}
+
+- (void)cancelLoadingImageNamed:(NSString *)name size:(CGSize)size {
+    NSString *key = [self.class keyForImageNamed:name size:size];
+
+    NSOperation *operation = self.operations[key];
+    if( operation == nil || operation.isExecuting || self.completionHandlers[key].count > 0 ) {
+        return;
+    }
+
+    [operation cancel];
+    [self.operations removeObjectForKey:key];
+}
+
+- (void)finishLoadingImage:(UIImage *)image forKey:(NSString *)key operation:(NSOperation *)operation {
+    // An operation that was cancelled after it started may finish after a newer one has been queued for the same key
+    if( self.operations[key] == operation ) {
+        [self.operations removeObjectForKey:key];
+    }
+
+    if( image != nil ) {
+        JSMStaticImageCacheEntry *entry = self.entries[key];
+        if( entry != nil ) {
+            self.totalCost -= entry.cost;
+        }
+        else {
+            entry = [JSMStaticImageCacheEntry new];
+            entry.key = key;
+            self.entries[key] = entry;
+        }
+
+        CGImageRef imageRef = image.CGImage;
+        entry.image = image;
+        entry.cost = imageRef != NULL ? CGImageGetBytesPerRow( imageRef ) * CGImageGetHeight( imageRef ) : 0;
+        self.totalCost += entry.cost;
+
+        [self moveEntryToFront:entry];
+        [self evictEntriesIfNeeded];
+    }
+
+    NSArray *completionHandlers = self.completionHandlers[key];
+    [self.completionHandlers removeObjectForKey:key];
+    for( void(^completion)(UIImage *) in completionHandlers ) {
+        completion( image );
+    }
+}
+
+#pragma mark - Decoding Images
+
++ (UIImage *)decodedImageNamed:(NSString *)name size:(CGSize)size scale:(CGFloat)scale {
+    UIImage *image = [UIImage imageNamed:name];
+    if( image == nil || image.size.width <= 0 || image.size.height <= 0 ) {
+        return image;
+    }
+
+    // Scale the image down to fit, but never up
+    CGSize decodedSize = image.size;
+    if( size.width > 0 && size.height > 0 && ( decodedSize.width > size.width || decodedSize.height > size.height ) ) {
+        CGFloat ratio = MIN( size.width / decodedSize.width, size.height / decodedSize.height );
+        decodedSize = CGSizeMake( MAX( 1, round( decodedSize.width * ratio ) ), MAX( 1, round( decodedSize.height * ratio ) ) );
+    }
+
+    // Drawing the image forces it to be decoded here, rather than on the main thread when it's first displayed.
+    // Downsampled images only need as many pixels as the screen shows, otherwise the original pixels are kept.
+    UIGraphicsImageRendererFormat *format = [UIGraphicsImageRendererFormat preferredFormat];
+    format.scale = CGSizeEqualToSize( decodedSize, image.size ) ? image.scale : scale;
+    format.opaque = NO;
+
+    UIGraphicsImageRenderer *renderer = [[UIGraphicsImageRenderer alloc] initWithSize:decodedSize format:format];
+    UIImage *decodedImage = [renderer imageWithActions:^(UIGraphicsImageRendererContext *context) {
+        [image drawInRect:CGRectMake( 0, 0, decodedSize.width, decodedSize.height )];
+    }];
+
+    return [decodedImage imageWithRenderingMode:image.renderingMode];
+}
+
+@end
+
+@implementation JSMStaticImageCacheEntry
+
+@end
@@ -23,6 +23,7 @@
 //
 
 #import "JSMStaticRow.h"
+#import "JSMStaticPreferenceStorage.h"
 
 @class JSMStaticPreference;
 
@@ -40,6 +41,10 @@ NS_ASSUME_NONNULL_BEGIN
 
 - (void)preference:(__kindof JSMStaticPreference *)preference didChangeValue:(id)value NS_SWIFT_NAME(preference(_:didChange:));
 
+- (void)preference:(__kindof JSMStaticPreference *)preference didChangeBoolValue:(BOOL)value NS_SWIFT_NAME(preference(_:didChangeBool:));
+
+- (void)preference:(__kindof JSMStaticPreference *)preference didChangeDoubleValue:(double)value NS_SWIFT_NAME(preference(_:didChangeDouble:));
+
 @end
 
 /**
@@ -115,7 +120,7 @@ NS_ASSUME_NONNULL_BEGIN
 ///---------------------------------------------
 
 /**
- * The key used to store the preference within `NSUserDefaults`.
+ * The key used to store the preference within its `storage`.
  *
  * If no key is provided, the value will not be stored, and will only live as long as the reciever
  * is in memory.
@@ -123,6 +128,16 @@ NS_ASSUME_NONNULL_BEGIN
 
 @property (nonatomic, strong, readonly, nullable) NSString *userDefaultsKey;
 
+/**
+ * The storage backend used for the preference's value.
+ *
+ * If this is nil, the `preferenceStorage` of the data source is used, and if that is also nil, the value
+ * is stored in the standard user defaults. Values are read and written through the `JSMStaticPreferenceCache`
+ * for the storage, which writes changes in batches.
+ */
+
+@property (nonatomic, strong, nullable) id<JSMStaticPreferenceStorage> storage;
+
 /**
  * The value of the preference.
  *
@@ -139,6 +154,53 @@ NS_ASSUME_NONNULL_BEGIN
 
 @property (nonatomic, copy, nullable) id defaultValue;
 
+/**
+ * Sets the value of the preference once the given delay has passed without another call to this method.
+ *
+ * This is intended for values that change rapidly while the user is editing, such as text being typed. Each call
+ * replaces the pending value and restarts the delay. Pending values for all preferences are managed by a single shared
+ * timer, and values that become due together are committed together, so they reach the storage in the same write.
+ *
+ * The `value` property continues to return the previous value until the pending value is committed.
+ *
+ * @param value The new value for the preference.
+ * @param delay The number of seconds to wait before committing the value.
+ */
+
+- (void)setValue:(nullable id)value afterDelay:(NSTimeInterval)delay NS_SWIFT_NAME(setValue(_:afterDelay:));
+
+/**
+ * Boolean flag to indicate if a value set with `setValue:afterDelay:` is waiting to be committed.
+ */
+
+@property (nonatomic, readonly) BOOL hasPendingValue;
+
+/**
+ * Immediately commits the value set with `setValue:afterDelay:`, if there is one.
+ */
+
+- (void)commitPendingValue;
+
+/**
+ * The value of the preference as a boolean.
+ *
+ * Subclasses that store booleans can use this instead of `value`, so that the value is kept as a scalar, and an
+ * object is only created for it when it's written to the storage. This will return the `defaultValue` if no
+ * value has been provided yet.
+ */
+
+@property (nonatomic) BOOL scalarBoolValue;
+
+/**
+ * The value of the preference as a double.
+ *
+ * Subclasses that store numbers can use this instead of `value`, so that the value is kept as a scalar, and an
+ * object is only created for it when it's written to the storage. This will return the `defaultValue` if no
+ * value has been provided yet.
+ */
+
+@property (nonatomic) double scalarDoubleValue;
+
 /**
  * Method for subclasses that is called just before the value is changed.
  *
@@ -190,6 +252,8 @@ NS_ASSUME_NONNULL_BEGIN
 
 /**
  * Method for subclasses that is called after the control has been loaded.
+ *
+ * For preferences that `recyclesControl`, this is also called whenever a control is borrowed from the pool.
  */
 
 - (void)controlDidLoad;
@@ -206,10 +270,56 @@ NS_ASSUME_NONNULL_BEGIN
 
 @property (nonatomic, strong, readonly, nullable) __kindof UIControl *controlIfLoaded;
 
+/**
+ * The size of the control used by instances of the reciever.
+ *
+ * Controls are only loaded when the preference is displayed, so this is used for laying out the preference's row
+ * until then. Subclasses that load a control should override this to return its typical size. Defaults to `CGSizeZero`.
+ *
+ * If a subclass doesn't override this, its control is loaded when the height of its row is first requested, so that
+ * it can be measured. Override it to keep controls from loading before their rows are displayed.
+ *
+ * @return The typical size of the control.
+ */
+
++ (CGSize)controlSize;
+
+/**
+ * Flag which allows the reciever to share its control with other preferences of the same class.
+ *
+ * When this is enabled, the control is borrowed from a pool when the preference is displayed, and returned to the pool
+ * when its cell is no longer displayed, so the number of controls is limited by the number of visible rows rather than
+ * the number of preferences. A borrowed control is prepared by `controlDidLoad` and any observers each time it is lent,
+ * so subclasses that support recycling should apply their value and add their targets there, rather than in
+ * `loadControl`. Defaults to `NO`.
+ */
+
+@property (nonatomic) BOOL recyclesControl;
+
+/**
+ * Method for subclasses that is called before the control is returned to the pool by a preference that `recyclesControl`.
+ *
+ * This allows subclasses to make sure their value reflects the control before it is used by another preference.
+ */
+
+- (void)controlWillBeRecycled;
+
+/**
+ * The number of layout constraints currently installed by preferences to fit their controls to cells.
+ *
+ * Constraints are installed once for each pairing of a control and a cell, so this should stay flat as a table view
+ * is scrolled. It is intended for use in tests and when debugging layout.
+ *
+ * @return The number of active constraints installed by all preferences.
+ */
+
++ (NSUInteger)numberOfActiveControlConstraints;
+
 /**
  * Boolean flag to indicate if the control should be enabled or not.
  *
- * This is to allow the control to be disabled without needing to load the control itself into memory.
+ * This is to allow the control to be disabled without needing to load the control itself into memory. The
+ * value of this property is applied to the control whenever it is loaded.
  */
 
 @property (nonatomic, getter=isEnabled) BOOL enabled;
@@ -23,10 +23,38 @@
 //
 
 #import "JSMStaticPreference.h"
+#import "JSMStaticPreferenceCache.h"
+#import "JSMStaticDataSource.h"
 
 @interface JSMStaticPreference ()
 
-@property (nonatomic, strong) NSMutableDictionary *observers;
+@property (nonatomic, strong) NSHashTable<id<JSMStaticPreferenceObserver>> *observers;
+
+@property (nonatomic, strong) NSHashTable<id<JSMStaticPreferenceObserver>> *didLoadControlObservers;
+
+@property (nonatomic, strong) NSHashTable<id<JSMStaticPreferenceObserver>> *willChangeValueObservers;
+
+@property (nonatomic, strong) NSHashTable<id<JSMStaticPreferenceObserver>> *didChangeValueObservers;
+
+@property (nonatomic, strong) NSHashTable<id<JSMStaticPreferenceObserver>> *didChangeBoolValueObservers;
+
+@property (nonatomic, strong) NSHashTable<id<JSMStaticPreferenceObserver>> *didChangeDoubleValueObservers;
+
+@property (nonatomic) NSUInteger notifyingObserversDepth;
+
+// Scalar value of a preference without a `userDefaultsKey`, which is used instead of `_value` if it's set.
+
+@property (nonatomic) double transientScalarValue;
+
+@property (nonatomic) BOOL transientScalarValueIsBool;
+
+@property (nonatomic) BOOL hasTransientScalarValue;
+
+@property (nonatomic, strong) NSArray<NSLayoutConstraint *> *controlConstraints;
+
+@property (nonatomic, weak) UIControl *constrainedControl;
+
+@property (nonatomic, weak) UITableViewCell *constrainedCell;
 
 @end
 
@@ -38,13 +66,31 @@
 
 - (void)performCustomConfiguration:(UITableViewCell *)cell;
 
+- (void)invalidateCachedHeight;
+
 @end
 
-@interface JSMStaticPreferenceObserverContainer: NSObject
+// A pool of controls that aren't being displayed, shared by all preferences of the same class.
+
+@interface JSMStaticControlPool : NSObject
+
++ (UIControl *)dequeueControlForPreferenceClass:(Class)preferenceClass;
+
++ (void)enqueueControl:(UIControl *)control forPreferenceClass:(Class)preferenceClass;
+
+@end
+
+// Commits values set with a delay for all preferences, using a single timer.
+
+@interface JSMStaticPendingValueScheduler : NSObject
+
++ (instancetype)sharedScheduler;
 
-@property (nonatomic, weak) id<JSMStaticPreferenceObserver> observer;
+- (void)scheduleValue:(id)value forPreference:(JSMStaticPreference *)preference afterDelay:(NSTimeInterval)delay;
 
-- (instancetype)initWithObserver:(id<JSMStaticPreferenceObserver>)observer;
+- (BOOL)hasValueForPreference:(JSMStaticPreference *)preference;
+
+- (void)commitValueForPreference:(JSMStaticPreference *)preference;
 
 @end
 
@@ -91,6 +137,14 @@
     _userDefaultsKey = userDefaultsKey;
 }
 
+- (JSMStaticPreferenceCache *)cache {
+	id<JSMStaticPreferenceStorage> storage = self.storage ?: self.dataSource.preferenceStorage;
+	if( storage == nil ) {
+		return [JSMStaticPreferenceCache sharedCache];
+	}
+	return [JSMStaticPreferenceCache cacheForStorage:storage];
+}
+
 @synthesize value = _value;
 
 - (void)setValue:(id)value {
@@ -103,16 +157,11 @@
 	// Store the value in the value property
 	if( self.userDefaultsKey == nil ) {
 		_value = value;
+		self.hasTransientScalarValue = NO;
 	}
-	// Clear NSUserDefaults for a nil value.
-    else if( value == nil ) {
-		[[NSUserDefaults standardUserDefaults] removeObjectForKey:self.userDefaultsKey];
-		[[NSUserDefaults standardUserDefaults] synchronize];
-    }
-	// Store the value in NSUserDefaults
+	// Store the value in the cache, which writes it to the storage later
     else {
-		[[NSUserDefaults standardUserDefaults] setValue:value forKey:self.userDefaultsKey];
-		[[NSUserDefaults standardUserDefaults] synchronize];
+		[self.cache setObject:value forKey:self.userDefaultsKey];
     }
     // We've changed the value
 	[self _valueDidChange];
@@ -120,9 +169,13 @@
 
 - (id)value {
     id value = nil;
-    // Fetch the value from NSUserDefaults
+    // Fetch the value from the storage cache
     if( self.userDefaultsKey != nil ) {
-        value = [[NSUserDefaults standardUserDefaults] valueForKey:self.userDefaultsKey];
+        value = [self.cache objectForKey:self.userDefaultsKey];
+    }
+    // Or from the scalar value, if one was stored
+    else if( self.hasTransientScalarValue ) {
+        value = self.transientScalarValueIsBool ? @((BOOL)( self.transientScalarValue != 0.0 )) : @(self.transientScalarValue);
     }
     // Or if we have to, from the value property
     else {
@@ -136,8 +189,84 @@
     return value;
 }
 
+- (BOOL)scalarBoolValue {
+	double value = 0;
+	if( ! [self getScalarValue:&value] ) {
+		return [self.defaultValue respondsToSelector:@selector(boolValue)] && [self.defaultValue boolValue];
+	}
+	return value != 0.0;
+}
+
+- (void)setScalarBoolValue:(BOOL)scalarBoolValue {
+	[self setScalarValue:( scalarBoolValue ? 1 : 0 ) isBool:YES];
+}
+
+- (double)scalarDoubleValue {
+	double value = 0;
+	if( ! [self getScalarValue:&value] ) {
+		return [self.defaultValue respondsToSelector:@selector(doubleValue)] ? [self.defaultValue doubleValue] : 0;
+	}
+	return value;
+}
+
+- (void)setScalarDoubleValue:(double)scalarDoubleValue {
+	[self setScalarValue:scalarDoubleValue isBool:NO];
+}
+
+- (BOOL)getScalarValue:(double *)value {
+	if( self.userDefaultsKey != nil ) {
+		return [self.cache getDouble:value forKey:self.userDefaultsKey];
+	}
+	else if( self.hasTransientScalarValue ) {
+		*value = self.transientScalarValue;
+		return YES;
+	}
+	else if( [_value isKindOfClass:[NSNumber class]] ) {
+		*value = [_value doubleValue];
+		return YES;
+	}
+	return NO;
+}
+
+- (void)setScalarValue:(double)value isBool:(BOOL)isBool {
+	// Don't update if the value doesn't change
+	double currentValue = 0;
+	if( [self getScalarValue:&currentValue] && ! ( currentValue < value || currentValue > value ) ) {
+		return;
+	}
+	// We'll be changing the value
+	[self _valueWillChange];
+	// Store the value without creating an object for it
+	if( self.userDefaultsKey == nil ) {
+		_value = nil;
+		self.transientScalarValue = value;
+		self.transientScalarValueIsBool = isBool;
+		self.hasTransientScalarValue = YES;
+	}
+	else if( isBool ) {
+		[self.cache setBool:( value != 0.0 ) forKey:self.userDefaultsKey];
+	}
+	else {
+		[self.cache setDouble:value forKey:self.userDefaultsKey];
+	}
+	// We've changed the value
+	[self _valueDidChange];
+}
+
+- (void)setValue:(id)value afterDelay:(NSTimeInterval)delay {
+	[[JSMStaticPendingValueScheduler sharedScheduler] scheduleValue:value forPreference:self afterDelay:delay];
+}
+
+- (BOOL)hasPendingValue {
+	return [[JSMStaticPendingValueScheduler sharedScheduler] hasValueForPreference:self];
+}
+
+- (void)commitPendingValue {
+	[[JSMStaticPendingValueScheduler sharedScheduler] commitValueForPreference:self];
+}
+
 - (BOOL)usingDefaultValue {
-	return _value == nil && ( self.userDefaultsKey == nil || [[NSUserDefaults standardUserDefaults] valueForKey:self.userDefaultsKey] == nil );
+	return _value == nil && ! self.hasTransientScalarValue && ( self.userDefaultsKey == nil || [self.cache objectForKey:self.userDefaultsKey] == nil );
 }
 
 - (void)setDefaultValue:(id)defaultValue {
@@ -164,13 +293,16 @@
 
 	[self valueWillChange];
 
-	for( JSMStaticPreferenceObserverContainer *ov in self.observers.allValues ) {
-		id<JSMStaticPreferenceObserver> observer = ov.observer;
-		if( observer == nil || ! [observer respondsToSelector:@selector(preference:willChangeValue:)] ) {
-			continue;
-		}
-		[observer preference:self willChangeValue:self.value];
+	if( self.willChangeValueObservers.count == 0 ) {
+		return;
+	}
+
+	id value = self.value;
+	self.notifyingObserversDepth += 1;
+	for( id<JSMStaticPreferenceObserver> observer in self.willChangeValueObservers ) {
+		[observer preference:self willChangeValue:value];
 	}
+	self.notifyingObserversDepth -= 1;
 }
 
 - (void)valueWillChange {
@@ -178,13 +310,27 @@
 }
 
 - (void)_valueDidChange {
-	for( JSMStaticPreferenceObserverContainer *ov in self.observers.allValues ) {
-		id<JSMStaticPreferenceObserver> observer = ov.observer;
-		if( observer == nil || ! [observer respondsToSelector:@selector(preference:didChangeValue:)] ) {
-			continue;
+	self.notifyingObserversDepth += 1;
+	// Only create the object for observers that need it
+	if( self.didChangeValueObservers.count > 0 ) {
+		id value = self.value;
+		for( id<JSMStaticPreferenceObserver> observer in self.didChangeValueObservers ) {
+			[observer preference:self didChangeValue:value];
 		}
-		[observer preference:self didChangeValue:self.value];
 	}
+	if( self.didChangeBoolValueObservers.count > 0 ) {
+		BOOL value = self.scalarBoolValue;
+		for( id<JSMStaticPreferenceObserver> observer in self.didChangeBoolValueObservers ) {
+			[observer preference:self didChangeBoolValue:value];
+		}
+	}
+	if( self.didChangeDoubleValueObservers.count > 0 ) {
+		double value = self.scalarDoubleValue;
+		for( id<JSMStaticPreferenceObserver> observer in self.didChangeDoubleValueObservers ) {
+			[observer preference:self didChangeDoubleValue:value];
+		}
+	}
+	self.notifyingObserversDepth -= 1;
 
 	[self valueDidChange];
 
@@ -222,18 +368,25 @@
 		return;
 	}
 
-	[self loadControl];
+	// Borrow a control that another preference has finished with, if we can
+	UIControl *control = self.recyclesControl ? [JSMStaticControlPool dequeueControlForPreferenceClass:self.class] : nil;
+	if( control != nil ) {
+		self.control = control;
+	}
+	else {
+		[self loadControl];
+	}
+
 	[self controlDidLoad];
+	[self invalidateCachedHeight];
 
 	_control.enabled = _enabled;
 
-	for( JSMStaticPreferenceObserverContainer *ov in self.observers.allValues ) {
-		id<JSMStaticPreferenceObserver> observer = ov.observer;
-		if( observer == nil || ! [observer respondsToSelector:@selector(preference:didLoadControl:)] ) {
-			continue;
-		}
-		[observer preference:self didLoadControl:self.control];
+	self.notifyingObserversDepth += 1;
+	for( id<JSMStaticPreferenceObserver> observer in self.didLoadControlObservers ) {
+		[observer preference:self didLoadControl:_control];
 	}
+	self.notifyingObserversDepth -= 1;
 }
 
 - (UIControl *)controlIfLoaded {
@@ -244,16 +397,52 @@
 	return _control;
 }
 
-@synthesize enabled = _enabled;
++ (CGSize)controlSize {
+	return CGSizeZero;
+}
 
-- (BOOL)isEnabled {
-	if( self.controlIfLoaded != nil ) {
-		return self.controlIfLoaded.isEnabled;
++ (BOOL)providesControlSize {
+	return [self methodForSelector:@selector(controlSize)] != [JSMStaticPreference methodForSelector:@selector(controlSize)];
+}
+
+- (void)controlWillBeRecycled {
+	// Subclass use only
+}
+
+- (void)recycleControl {
+	UIControl *control = _control;
+	if( ! self.recyclesControl || control == nil || control.isFirstResponder ) {
+		return;
 	}
 
-	return _enabled;
+	// Make sure the preference has everything it needs from the control before anyone else uses it.
+	[self controlWillBeRecycled];
+	_enabled = control.isEnabled;
+
+	[control removeTarget:self action:NULL forControlEvents:UIControlEventAllEvents];
+	[self removeControlConstraints];
+	[control removeFromSuperview];
+	if( self.accessoryView == control ) {
+		self.accessoryView = nil;
+	}
+	_control = nil;
+
+	[JSMStaticControlPool enqueueControl:control forPreferenceClass:self.class];
+}
+
+- (void)setControl:(UIControl *)control {
+	_control = control;
+	[self invalidateCachedHeight];
 }
 
+- (void)setFitControlToCell:(BOOL)fitControlToCell {
+	_fitControlToCell = fitControlToCell;
+	[self removeControlConstraints];
+	[self invalidateCachedHeight];
+}
+
+@synthesize enabled = _enabled;
+
 - (void)setEnabled:(BOOL)enabled {
 	_enabled = enabled;
 
@@ -277,28 +466,89 @@
         }
         if( ! self.fitControlToCell ) {
             if( ! [self.accessoryView isEqual:self.control] ) {
+				[self removeControlConstraints];
 				self.control.translatesAutoresizingMaskIntoConstraints = YES;
                 self.accessoryView = self.control;
             }
         }
         else if( self.fitControlToCell ) {
-			if( ! [self.control.superview isEqual:cell.contentView] ) {
-				[cell.contentView addSubview:self.control];
-			}
-
-			self.control.translatesAutoresizingMaskIntoConstraints = NO;
-			[cell.contentView addConstraints:@[
-											  [NSLayoutConstraint constraintWithItem:self.control attribute:NSLayoutAttributeTop relatedBy:NSLayoutRelationEqual toItem:cell.contentView attribute:NSLayoutAttributeTopMargin multiplier:1 constant:0],
-											  [NSLayoutConstraint constraintWithItem:self.control attribute:NSLayoutAttributeBottom relatedBy:NSLayoutRelationEqual toItem:cell.contentView attribute:NSLayoutAttributeBottomMargin multiplier:1 constant:0],
-											  [NSLayoutConstraint constraintWithItem:self.control attribute:NSLayoutAttributeLeft relatedBy:NSLayoutRelationEqual toItem:cell.contentView attribute:NSLayoutAttributeLeftMargin multiplier:1 constant:0],
-											  [NSLayoutConstraint constraintWithItem:self.control attribute:NSLayoutAttributeRight relatedBy:NSLayoutRelationEqual toItem:cell.contentView attribute:NSLayoutAttributeRightMargin multiplier:1 constant:0]
-											  ]];
+			[self installControlInCell:cell withConstraints:^NSArray<NSLayoutConstraint *> *(UIControl *control, UITableViewCell *cell) {
+				return @[
+						 [NSLayoutConstraint constraintWithItem:control attribute:NSLayoutAttributeTop relatedBy:NSLayoutRelationEqual toItem:cell.contentView attribute:NSLayoutAttributeTopMargin multiplier:1 constant:0],
+						 [NSLayoutConstraint constraintWithItem:control attribute:NSLayoutAttributeBottom relatedBy:NSLayoutRelationEqual toItem:cell.contentView attribute:NSLayoutAttributeBottomMargin multiplier:1 constant:0],
+						 [NSLayoutConstraint constraintWithItem:control attribute:NSLayoutAttributeLeft relatedBy:NSLayoutRelationEqual toItem:cell.contentView attribute:NSLayoutAttributeLeftMargin multiplier:1 constant:0],
+						 [NSLayoutConstraint constraintWithItem:control attribute:NSLayoutAttributeRight relatedBy:NSLayoutRelationEqual toItem:cell.contentView attribute:NSLayoutAttributeRightMargin multiplier:1 constant:0]
+						 ];
+			}];
         }
     }
 
 	[self performCustomConfiguration:cell];
 }
 
+#pragma mark - Constraining the control
+
+- (void)installControlInCell:(UITableViewCell *)cell withConstraints:(NSArray<NSLayoutConstraint *> *(^)(UIControl *control, UITableViewCell *cell))constraintsBlock {
+	UIControl *control = self.control;
+
+	if( ! [control.superview isEqual:cell.contentView] ) {
+		[cell.contentView addSubview:control];
+	}
+
+	// The control's frame no longer decides the height once it's pinned to the cell.
+	if( control.translatesAutoresizingMaskIntoConstraints ) {
+		control.translatesAutoresizingMaskIntoConstraints = NO;
+		[self invalidateCachedHeight];
+	}
+
+	// Constraints only need installing once for each pairing of control and cell. Moving the control to another cell
+	// removes them automatically, so we also check they're still active.
+	if( control == self.constrainedControl && cell == self.constrainedCell && self.controlConstraints.firstObject.isActive ) {
+		return;
+	}
+
+	[self removeControlConstraints];
+
+	self.controlConstraints = constraintsBlock( control, cell );
+	self.constrainedControl = control;
+	self.constrainedCell = cell;
+	[NSLayoutConstraint activateConstraints:self.controlConstraints];
+
+	[[JSMStaticPreference constrainedPreferences] addObject:self];
+}
+
+- (void)removeControlConstraints {
+	if( self.controlConstraints == nil ) {
+		return;
+	}
+
+	[NSLayoutConstraint deactivateConstraints:self.controlConstraints];
+	self.controlConstraints = nil;
+	self.constrainedControl = nil;
+	self.constrainedCell = nil;
+
+	[[JSMStaticPreference constrainedPreferences] removeObject:self];
+}
+
++ (NSHashTable<JSMStaticPreference *> *)constrainedPreferences {
+	static NSHashTable *constrainedPreferences = nil;
+	static dispatch_once_t onceToken;
+	dispatch_once(&onceToken, ^{
+		constrainedPreferences = [NSHashTable weakObjectsHashTable];
+	});
+	return constrainedPreferences;
+}
+
++ (NSUInteger)numberOfActiveControlConstraints {
+	NSUInteger count = 0;
+	for( JSMStaticPreference *preference in [JSMStaticPreference constrainedPreferences] ) {
+		for( NSLayoutConstraint *constraint in preference.controlConstraints ) {
+			count += constraint.isActive ? 1 : 0;
+		}
+	}
+	return count;
+}
+
 #pragma mark - Observers
 
 - (void)addObserver:(id <JSMStaticPreferenceObserver>)observer {
@@ -312,47 +562,190 @@
         return;
     }
 
-    // Add the observers array
-    if( self.observers == nil ) {
-        self.observers = [NSMutableDictionary dictionary];
-    }
+    [self prepareObserversForMutation];
 
-    // Add the value
-    NSString *key = [NSString stringWithFormat:@"%@",@(observer.hash)];
-	self.observers[key] = [[JSMStaticPreferenceObserverContainer alloc] initWithObserver:observer];
+    // Add the observer, along with the callbacks it responds to
+    [self.observers addObject:observer];
+    if( [observer respondsToSelector:@selector(preference:didLoadControl:)] ) {
+        [self.didLoadControlObservers addObject:observer];
+    }
+    if( [observer respondsToSelector:@selector(preference:willChangeValue:)] ) {
+        [self.willChangeValueObservers addObject:observer];
+    }
+    if( [observer respondsToSelector:@selector(preference:didChangeValue:)] ) {
+        [self.didChangeValueObservers addObject:observer];
+    }
+    if( [observer respondsToSelector:@selector(preference:didChangeBoolValue:)] ) {
+        [self.didChangeBoolValueObservers addObject:observer];
+    }
+    if( [observer respondsToSelector:@selector(preference:didChangeDoubleValue:)] ) {
+        [self.didChangeDoubleValueObservers addObject:observer];
+    }
 }
 
 - (void)removeObserver:(id <JSMStaticPreferenceObserver>)observer {
-    // Observer is nil
-    if( observer == nil ) {
-        return;
-    }
-
     // Observer isn't observing
     if( ! [self hasObserver:observer] ) {
         return;
     }
 
-    // Add the value
-    NSString *key = [NSString stringWithFormat:@"%@",@(observer.hash)];
-    [self.observers removeObjectForKey:key];
+    [self prepareObserversForMutation];
+
+    // Remove the observer
+    [self.observers removeObject:observer];
+    [self.didLoadControlObservers removeObject:observer];
+    [self.willChangeValueObservers removeObject:observer];
+    [self.didChangeValueObservers removeObject:observer];
+    [self.didChangeBoolValueObservers removeObject:observer];
+    [self.didChangeDoubleValueObservers removeObject:observer];
 }
 
 - (BOOL)hasObserver:(id <JSMStaticPreferenceObserver>)observer {
-    NSString *key = [NSString stringWithFormat:@"%@",@(observer.hash)];
-    return ( self.observers != nil && self.observers[key] != nil );
+    return observer != nil && [self.observers containsObject:observer];
+}
+
+- (void)prepareObserversForMutation {
+    // Observers are held weakly, so deallocated observers are removed automatically.
+    if( self.observers == nil ) {
+        NSPointerFunctionsOptions options = NSPointerFunctionsWeakMemory|NSPointerFunctionsObjectPointerPersonality;
+        self.observers = [NSHashTable hashTableWithOptions:options];
+        self.didLoadControlObservers = [NSHashTable hashTableWithOptions:options];
+        self.willChangeValueObservers = [NSHashTable hashTableWithOptions:options];
+        self.didChangeValueObservers = [NSHashTable hashTableWithOptions:options];
+        self.didChangeBoolValueObservers = [NSHashTable hashTableWithOptions:options];
+        self.didChangeDoubleValueObservers = [NSHashTable hashTableWithOptions:options];
+    }
+    // Observers being notified may add or remove observers, so we leave the tables being enumerated untouched.
+    else if( self.notifyingObserversDepth > 0 ) {
+        self.observers = self.observers.copy;
+        self.didLoadControlObservers = self.didLoadControlObservers.copy;
+        self.willChangeValueObservers = self.willChangeValueObservers.copy;
+        self.didChangeValueObservers = self.didChangeValueObservers.copy;
+        self.didChangeBoolValueObservers = self.didChangeBoolValueObservers.copy;
+        self.didChangeDoubleValueObservers = self.didChangeDoubleValueObservers.copy;
+    }
 }
 
 @end
 
-@implementation JSMStaticPreferenceObserverContainer
+@implementation JSMStaticControlPool
+
++ (NSMapTable *)controls {
+	static NSMapTable *controls = nil;
+	static dispatch_once_t onceToken;
+	dispatch_once(&onceToken, ^{
+		controls = [NSMapTable strongToStrongObjectsMapTable];
+	});
+	return controls;
+}
 
-- (instancetype)initWithObserver:(id<JSMStaticPreferenceObserver>)observer {
-	if( (self = [super init]) ) {
-		self.observer = observer;
++ (UIControl *)dequeueControlForPreferenceClass:(Class)preferenceClass {
+	NSMutableArray<UIControl *> *controls = [self.controls objectForKey:preferenceClass];
+	UIControl *control = controls.lastObject;
+	[controls removeLastObject];
+	return control;
+}
+
++ (void)enqueueControl:(UIControl *)control forPreferenceClass:(Class)preferenceClass {
+	NSMutableArray<UIControl *> *controls = [self.controls objectForKey:preferenceClass];
+	if( controls == nil ) {
+		controls = [NSMutableArray array];
+		[self.controls setObject:controls forKey:preferenceClass];
 	}
+	[controls addObject:control];
+}
+
+@end
 
+@interface JSMStaticPendingValueScheduler ()
+
+@property (nonatomic, strong) NSMapTable<JSMStaticPreference *, id> *values;
+
+@property (nonatomic, strong) NSMapTable<JSMStaticPreference *, NSDate *> *commitDates;
+
+@property (nonatomic, strong) NSTimer *timer;
+
+@end
+
+@implementation JSMStaticPendingValueScheduler
+
++ (instancetype)sharedScheduler {
+	static JSMStaticPendingValueScheduler *sharedScheduler = nil;
+	static dispatch_once_t onceToken;
+	dispatch_once(&onceToken, ^{
+		sharedScheduler = [[self alloc] init];
+	});
+	return sharedScheduler;
+}
+
+- (instancetype)init {
+	if( ( self = [super init] ) ) {
+		// Preferences compare by content, so they need to be tracked by identity
+		NSPointerFunctionsOptions keyOptions = NSPointerFunctionsStrongMemory|NSPointerFunctionsObjectPointerPersonality;
+		_values = [[NSMapTable alloc] initWithKeyOptions:keyOptions valueOptions:NSPointerFunctionsStrongMemory capacity:0];
+		_commitDates = [[NSMapTable alloc] initWithKeyOptions:keyOptions valueOptions:NSPointerFunctionsStrongMemory capacity:0];
+
+		// The timer is never invalidated, it's just moved to the next date a value is due.
+		JSMStaticPendingValueScheduler __weak *weakSelf = self;
+		_timer = [NSTimer timerWithTimeInterval:[NSDate distantFuture].timeIntervalSinceNow repeats:YES block:^(NSTimer *timer) {
+			[weakSelf commitDueValues];
+		}];
+		_timer.fireDate = [NSDate distantFuture];
+		_timer.tolerance = 0.05;
+		[[NSRunLoop mainRunLoop] addTimer:_timer forMode:NSRunLoopCommonModes];
+	}
 	return self;
 }
 
+- (void)scheduleValue:(id)value forPreference:(JSMStaticPreference *)preference afterDelay:(NSTimeInterval)delay {
+	NSDate *commitDate = [NSDate dateWithTimeIntervalSinceNow:delay];
+
+	[self.values setObject:( value ?: [NSNull null] ) forKey:preference];
+	[self.commitDates setObject:commitDate forKey:preference];
+
+	// Values that are pushed back will be picked up when the timer next fires, so it only needs to move forward.
+	if( [commitDate compare:self.timer.fireDate] == NSOrderedAscending ) {
+		self.timer.fireDate = commitDate;
+	}
+}
+
+- (BOOL)hasValueForPreference:(JSMStaticPreference *)preference {
+	return [self.values objectForKey:preference] != nil;
+}
+
+- (void)commitValueForPreference:(JSMStaticPreference *)preference {
+	id value = [self.values objectForKey:preference];
+	if( value == nil ) {
+		return;
+	}
+
+	[self.values removeObjectForKey:preference];
+	[self.commitDates removeObjectForKey:preference];
+
+	preference.value = ( value == [NSNull null] ) ? nil : value;
+}
+
+- (void)commitDueValues {
+	// Anything due within the timer's tolerance is committed now too, so it shares the same storage write.
+	NSDate *dueDate = [NSDate dateWithTimeIntervalSinceNow:self.timer.tolerance];
+	NSDate *nextCommitDate = [NSDate distantFuture];
+
+	NSMutableArray<JSMStaticPreference *> *duePreferences = [NSMutableArray array];
+	for( JSMStaticPreference *preference in self.commitDates ) {
+		NSDate *commitDate = [self.commitDates objectForKey:preference];
+		if( [commitDate compare:dueDate] != NSOrderedDescending ) {
+			[duePreferences addObject:preference];
+		}
+		else {
+			nextCommitDate = [nextCommitDate earlierDate:commitDate];
+		}
+	}
+
+	self.timer.fireDate = nextCommitDate;
+
+	for( JSMStaticPreference *preference in duePreferences ) {
+		[self commitValueForPreference:preference];
+	}
+}
+
 @end
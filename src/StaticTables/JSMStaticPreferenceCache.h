@@ -0,0 +1,186 @@
+//
+// Copyright © 2019 Daniel Farrelly
+//
+// Redistribution and use in source and binary forms, with or without modification,
+// are permitted provided that the following conditions are met:
+//
+// *	Redistributions of source code must retain the above copyright notice, this list
+//		of conditions and the following disclaimer.
+// *	Redistributions in binary form must reproduce the above copyright notice, this
+//		list of conditions and the following disclaimer in the documentation and/or
+//		other materials provided with the distribution.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+// ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+// WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+// IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+// INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+// BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+// DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+// LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE
+// OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+// ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//
+
+@import UIKit;
+#import "JSMStaticPreferenceStorage.h"
+
+NS_ASSUME_NONNULL_BEGIN
+
+/**
+ * A `JSMStaticPreferenceCache` keeps the values of preferences in memory, so that reading them is inexpensive, and
+ * writes changes back to a storage backend in batches, so that changing them doesn't block the main thread.
+ *
+ * Changes are written back once `flushInterval` has passed since the first unsaved change, as well as when the
+ * application enters the background or terminates. If the storage posts a `JSMStaticPreferenceStorageDidChangeNotification`,
+ * values that haven't been changed through the reciever are read again.
+ */
+
+@interface JSMStaticPreferenceCache : NSObject
+
+///---------------------------------------------
+/// @name Creating Caches
+///---------------------------------------------
+
+/**
+ * The cache for the standard user defaults storage, which is used by preferences unless another storage is provided.
+ *
+ * @return The shared instance of `JSMStaticPreferenceCache`.
+ */
+
++ (instancetype)sharedCache;
+
+/**
+ * Fetch the cache for the given storage backend, creating it if needed.
+ *
+ * There is only one cache for each storage backend, so that all the preferences that use it stay in step. The cache
+ * is owned by the storage, and is released along with it.
+ *
+ * @param storage The storage backend to read values from and write changes to.
+ * @return The instance of `JSMStaticPreferenceCache` for the given storage.
+ */
+
++ (instancetype)cacheForStorage:(id<JSMStaticPreferenceStorage>)storage NS_SWIFT_NAME(init(storage:));
+
+- (instancetype)init NS_UNAVAILABLE;
+
+/**
+ * The storage backend the reciever reads values from and writes changes to.
+ *
+ * The storage owns the reciever, so this is a weak reference. Storage with unsaved changes is kept alive until they
+ * have been written.
+ */
+
+@property (nonatomic, weak, readonly, nullable) id<JSMStaticPreferenceStorage> storage;
+
+///---------------------------------------------
+/// @name Accessing Values
+///---------------------------------------------
+
+/**
+ * Fetch the value for the given key.
+ *
+ * The storage is only read the first time a key is requested.
+ *
+ * @param key The key to fetch the value for.
+ * @return The value for the given key, or `nil` if there is no value.
+ */
+
+- (id _Nullable)objectForKey:(NSString *)key;
+
+/**
+ * Read the values for the given keys from the storage in one batch, if they haven't been read already.
+ *
+ * This is useful for avoiding a separate read for each preference in a large set.
+ *
+ * @param keys The keys to read the values for.
+ */
+
+- (void)loadObjectsForKeys:(NSArray<NSString *> *)keys NS_SWIFT_NAME(loadObjects(for:));
+
+/**
+ * Change the value for the given key.
+ *
+ * The change is visible immediately, but is only written to the storage when the reciever is flushed.
+ *
+ * @param object The value to store, or `nil` to remove the value for the given key.
+ * @param key The key to store the value for.
+ */
+
+- (void)setObject:(id _Nullable)object forKey:(NSString *)key;
+
+///---------------------------------------------
+/// @name Accessing Scalar Values
+///---------------------------------------------
+
+/**
+ * Fetch the value for the given key as a boolean.
+ *
+ * @param value Pointer to a boolean that is set to the value, if there is one.
+ * @param key The key to fetch the value for.
+ * @return Flag indicating if there is a numeric value for the given key.
+ */
+
+- (BOOL)getBool:(BOOL *)value forKey:(NSString *)key;
+
+/**
+ * Change the value for the given key to a boolean.
+ *
+ * Scalar values are kept as they are, and an object is only created for them when they are written to the storage,
+ * or fetched with `objectForKey:`.
+ *
+ * @param value The value to store.
+ * @param key The key to store the value for.
+ */
+
+- (void)setBool:(BOOL)value forKey:(NSString *)key NS_SWIFT_NAME(set(_:forKey:));
+
+/**
+ * Fetch the value for the given key as a double.
+ *
+ * @param value Pointer to a double that is set to the value, if there is one.
+ * @param key The key to fetch the value for.
+ * @return Flag indicating if there is a numeric value for the given key.
+ */
+
+- (BOOL)getDouble:(double *)value forKey:(NSString *)key;
+
+/**
+ * Change the value for the given key to a double.
+ *
+ * Scalar values are kept as they are, and an object is only created for them when they are written to the storage,
+ * or fetched with `objectForKey:`.
+ *
+ * @param value The value to store.
+ * @param key The key to store the value for.
+ */
+
+- (void)setDouble:(double)value forKey:(NSString *)key NS_SWIFT_NAME(set(_:forKey:));
+
+///---------------------------------------------
+/// @name Writing Changes
+///---------------------------------------------
+
+/**
+ * The time in seconds between the first unsaved change and changes being written to the storage.
+ *
+ * Defaults to one second.
+ */
+
+@property (nonatomic) NSTimeInterval flushInterval;
+
+/**
+ * Flag indicating if the reciever has changes that haven't been written to the storage.
+ */
+
+@property (nonatomic, readonly) BOOL hasPendingChanges;
+
+/**
+ * Immediately write any unsaved changes to the storage, and flush the storage itself.
+ */
+
+- (void)flush;
+
+@end
+
+NS_ASSUME_NONNULL_END
@@ -0,0 +1,261 @@
+//
+// Copyright © 2019 Daniel Farrelly
+//
+// Redistribution and use in source and binary forms, with or without modification,
+// are permitted provided that the following conditions are met:
+//
+// *	Redistributions of source code must retain the above copyright notice, this list
+//		of conditions and the following disclaimer.
+// *	Redistributions in binary form must reproduce the above copyright notice, this
+//		list of conditions and the following disclaimer in the documentation and/or
+//		other materials provided with the distribution.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+// ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+// WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+// IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+// INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+// BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+// DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+// LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE
+// OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+// ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//
+
+#import <objc/runtime.h>
+#import "JSMStaticPreferenceCache.h"
+#import "JSMStaticUserDefaultsStorage.h"
+
+// A scalar value stored in the cache, reused for every change to the same key.
+
+@interface JSMStaticPreferenceCacheScalar : NSObject
+
+@property (nonatomic) double value;
+
+@property (nonatomic, getter=isBool) BOOL boolean;
+
+- (NSNumber *)object;
+
+@end
+
+@interface JSMStaticPreferenceCache ()
+
+@property (nonatomic, strong) NSMutableDictionary<NSString *, id> *values;
+
+@property (nonatomic, strong) NSMutableDictionary<NSString *, JSMStaticPreferenceCacheScalar *> *scalars;
+
+@property (nonatomic, strong) NSMutableSet<NSString *> *pendingKeys;
+
+// The storage owns its cache, so we only hold on to it while there are changes waiting to be written.
+@property (nonatomic, strong) id<JSMStaticPreferenceStorage> pendingStorage;
+
+@property (nonatomic, strong) NSTimer *timer;
+
+@property (nonatomic, getter=isFlushing) BOOL flushing;
+
+@end
+
+@implementation JSMStaticPreferenceCache
+
+#pragma mark - Creating Caches
+
++ (instancetype)sharedCache {
+	return [self cacheForStorage:[JSMStaticUserDefaultsStorage standardStorage]];
+}
+
++ (instancetype)cacheForStorage:(id<JSMStaticPreferenceStorage>)storage {
+	// The cache is attached to the storage, so it's released along with it.
+	JSMStaticPreferenceCache *cache = objc_getAssociatedObject(storage, @selector(cacheForStorage:));
+	if( cache == nil ) {
+		cache = [[self alloc] initWithStorage:storage];
+		objc_setAssociatedObject(storage, @selector(cacheForStorage:), cache, OBJC_ASSOCIATION_RETAIN_NONATOMIC);
+	}
+	return cache;
+}
+
+- (instancetype)initWithStorage:(id<JSMStaticPreferenceStorage>)storage {
+	if( ( self = [super init] ) ) {
+		_storage = storage;
+		_values = [NSMutableDictionary dictionary];
+		_scalars = [NSMutableDictionary dictionary];
+		_pendingKeys = [NSMutableSet set];
+		_flushInterval = 1.0;
+
+		NSNotificationCenter *notificationCenter = [NSNotificationCenter defaultCenter];
+		[notificationCenter addObserver:self selector:@selector(applicationWillFinish:) name:UIApplicationDidEnterBackgroundNotification object:nil];
+		[notificationCenter addObserver:self selector:@selector(applicationWillFinish:) name:UIApplicationWillTerminateNotification object:nil];
+		[notificationCenter addObserver:self selector:@selector(storageDidChange:) name:JSMStaticPreferenceStorageDidChangeNotification object:storage];
+	}
+	return self;
+}
+
+- (void)dealloc {
+	[[NSNotificationCenter defaultCenter] removeObserver:self];
+	[self flush];
+}
+
+#pragma mark - Accessing Values
+
+- (id)objectForKey:(NSString *)key {
+	id value = [self storedValueForKey:key];
+	if( [value isKindOfClass:[JSMStaticPreferenceCacheScalar class]] ) {
+		return [(JSMStaticPreferenceCacheScalar *)value object];
+	}
+	return value == [NSNull null] ? nil : value;
+}
+
+- (id)storedValueForKey:(NSString *)key {
+	id value = self.values[key];
+	if( value == nil ) {
+		[self loadObjectsForKeys:@[key]];
+		value = self.values[key];
+	}
+	return value;
+}
+
+- (void)loadObjectsForKeys:(NSArray<NSString *> *)keys {
+	NSMutableArray<NSString *> *missingKeys = [NSMutableArray arrayWithCapacity:keys.count];
+	for( NSString *key in keys ) {
+		if( self.values[key] == nil ) {
+			[missingKeys addObject:key];
+		}
+	}
+
+	if( missingKeys.count == 0 ) {
+		return;
+	}
+
+	// Keys without a value are stored as null, so we don't keep reading them.
+	NSDictionary<NSString *, id> *objects = [self.storage objectsForKeys:missingKeys];
+	for( NSString *key in missingKeys ) {
+		self.values[key] = objects[key] ?: [NSNull null];
+	}
+}
+
+- (void)setObject:(id)object forKey:(NSString *)key {
+	self.values[key] = object ?: [NSNull null];
+	[self setNeedsFlushForKey:key];
+}
+
+- (void)setNeedsFlushForKey:(NSString *)key {
+	[self.pendingKeys addObject:key];
+	self.pendingStorage = self.storage;
+
+	if( self.timer == nil ) {
+		self.timer = [NSTimer timerWithTimeInterval:self.flushInterval target:self selector:@selector(timerFired:) userInfo:nil repeats:NO];
+		[[NSRunLoop mainRunLoop] addTimer:self.timer forMode:NSRunLoopCommonModes];
+	}
+}
+
+#pragma mark - Accessing Scalar Values
+
+- (BOOL)getBool:(BOOL *)value forKey:(NSString *)key {
+	double doubleValue = 0;
+	if( ! [self getDouble:&doubleValue forKey:key] ) {
+		return NO;
+	}
+	*value = doubleValue != 0.0;
+	return YES;
+}
+
+- (void)setBool:(BOOL)value forKey:(NSString *)key {
+	[self setScalar:( value ? 1 : 0 ) forKey:key boolean:YES];
+}
+
+- (BOOL)getDouble:(double *)value forKey:(NSString *)key {
+	id storedValue = [self storedValueForKey:key];
+	if( [storedValue isKindOfClass:[JSMStaticPreferenceCacheScalar class]] ) {
+		*value = ((JSMStaticPreferenceCacheScalar *)storedValue).value;
+		return YES;
+	}
+	if( [storedValue isKindOfClass:[NSNumber class]] ) {
+		*value = ((NSNumber *)storedValue).doubleValue;
+		return YES;
+	}
+	return NO;
+}
+
+- (void)setDouble:(double)value forKey:(NSString *)key {
+	[self setScalar:value forKey:key boolean:NO];
+}
+
+- (void)setScalar:(double)value forKey:(NSString *)key boolean:(BOOL)boolean {
+	JSMStaticPreferenceCacheScalar *scalar = self.scalars[key];
+	if( scalar == nil ) {
+		scalar = [JSMStaticPreferenceCacheScalar new];
+		self.scalars[key] = scalar;
+	}
+	scalar.value = value;
+	scalar.boolean = boolean;
+
+	self.values[key] = scalar;
+	[self setNeedsFlushForKey:key];
+}
+
+#pragma mark - Writing Changes
+
+- (BOOL)hasPendingChanges {
+	return self.pendingKeys.count > 0;
+}
+
+- (void)flush {
+	[self.timer invalidate];
+	self.timer = nil;
+
+	id<JSMStaticPreferenceStorage> storage = self.pendingStorage ?: self.storage;
+	self.pendingStorage = nil;
+
+	if( self.pendingKeys.count == 0 || storage == nil ) {
+		return;
+	}
+
+	NSMutableDictionary<NSString *, id> *objects = [NSMutableDictionary dictionaryWithCapacity:self.pendingKeys.count];
+	for( NSString *key in self.pendingKeys ) {
+		id value = self.values[key];
+		// Scalar values only become objects once they're written to the storage.
+		if( [value isKindOfClass:[JSMStaticPreferenceCacheScalar class]] ) {
+			value = [(JSMStaticPreferenceCacheScalar *)value object];
+		}
+		objects[key] = value;
+	}
+	[self.pendingKeys removeAllObjects];
+
+	self.flushing = YES;
+	[storage setObjects:objects];
+	[storage flush];
+	self.flushing = NO;
+}
+
+- (void)timerFired:(NSTimer *)timer {
+	[self flush];
+}
+
+#pragma mark - Notifications
+
+- (void)applicationWillFinish:(NSNotification *)notification {
+	[self flush];
+}
+
+- (void)storageDidChange:(NSNotification *)notification {
+	if( self.isFlushing ) {
+		return;
+	}
+
+	// Something else changed the storage, so anything we haven't changed ourselves needs to be read again.
+	for( NSString *key in self.values.allKeys ) {
+		if( ! [self.pendingKeys containsObject:key] ) {
+			[self.values removeObjectForKey:key];
+		}
+	}
+}
+
+@end
+
+@implementation JSMStaticPreferenceCacheScalar
+
+- (NSNumber *)object {
+	// Booleans need to be boxed as a BOOL, so they're stored as a boolean rather than an integer
+	return self.isBool ? @((BOOL)( self.value != 0.0 )) : @(self.value);
+}
+
+@end
@@ -0,0 +1,72 @@
+//
+// Copyright © 2019 Daniel Farrelly
+//
+// Redistribution and use in source and binary forms, with or without modification,
+// are permitted provided that the following conditions are met:
+//
+// *	Redistributions of source code must retain the above copyright notice, this list
+//		of conditions and the following disclaimer.
+// *	Redistributions in binary form must reproduce the above copyright notice, this
+//		list of conditions and the following disclaimer in the documentation and/or
+//		other materials provided with the distribution.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+// ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+// WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+// IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+// INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+// BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+// DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+// LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE
+// OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+// ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//
+
+@import Foundation;
+
+NS_ASSUME_NONNULL_BEGIN
+
+/**
+ * Notification posted by a storage backend when its contents are changed by something other than a call to
+ * `setObjects:`, such as another process. The notification object is the storage backend.
+ */
+
+extern NSNotificationName const JSMStaticPreferenceStorageDidChangeNotification NS_SWIFT_NAME(JSMStaticPreferenceStorage.didChangeNotification);
+
+/**
+ * The `JSMStaticPreferenceStorage` protocol is adopted by objects that store the values of `JSMStaticPreference`
+ * instances.
+ *
+ * Preferences don't talk to storage backends directly, but through a `JSMStaticPreferenceCache`, which reads values
+ * once and writes changes in batches. Implementations are therefore free to make each call relatively expensive.
+ */
+
+NS_SWIFT_NAME(JSMStaticPreferenceStorage)
+@protocol JSMStaticPreferenceStorage <NSObject>
+
+/**
+ * Fetch the stored values for the given keys.
+ *
+ * @param keys The keys to fetch the values for.
+ * @return A dictionary of the values that exist for the given keys. Keys without a value are not included.
+ */
+
+- (NSDictionary<NSString *, id> *)objectsForKeys:(NSArray<NSString *> *)keys NS_SWIFT_NAME(objects(for:));
+
+/**
+ * Store the given values.
+ *
+ * @param objects A dictionary of the values to store. A value of `NSNull` removes the stored value for that key.
+ */
+
+- (void)setObjects:(NSDictionary<NSString *, id> *)objects NS_SWIFT_NAME(setObjects(_:));
+
+/**
+ * Write any stored values that are held in memory to their permanent location.
+ */
+
+- (void)flush;
+
+@end
+
+NS_ASSUME_NONNULL_END
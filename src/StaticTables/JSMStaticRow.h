@@ -147,6 +147,22 @@ NS_ASSUME_NONNULL_BEGIN
 
 @property (nonatomic, copy, nullable) UIImage *image;
 
+/**
+ * The name of an image to load for the `UITableViewCell`'s `imageView` content. This is ignored if an `image` is set.
+ *
+ * The image is loaded through the shared `JSMStaticImageCache`, so it's decoded on a background queue and shown once
+ * it's ready, rather than holding up the cell being displayed.
+ */
+
+@property (nonatomic, copy, nullable) NSString *imageName;
+
+/**
+ * The size the image named by `imageName` is scaled down to fit within. Defaults to `CGSizeZero`, which keeps the
+ * image at its original size.
+ */
+
+@property (nonatomic) CGSize imageSize;
+
 /**
  * The cell style used for the `UITableViewCell` instance.
  */
@@ -215,6 +231,25 @@ typedef void(^JSMStaticTableViewCellConfiguration)( JSMStaticRow *row, __kindof
 
 - (void)configurationForCell:(JSMStaticTableViewCellConfiguration)configurationBlock NS_SWIFT_NAME(configurationForCell(handler:));
 
+/**
+ * The number of times rows have written their content to a cell property.
+ *
+ * Rows only write to properties that differ from what the cell already shows. Together with
+ * `numberOfSkippedCellPropertyWrites`, this is intended for use in tests and when profiling.
+ *
+ * @return The number of cell property writes performed by all rows.
+ */
+
++ (NSUInteger)numberOfCellPropertyWrites;
+
+/**
+ * The number of times rows have skipped writing to a cell property because the cell already showed the value.
+ *
+ * @return The number of cell property writes skipped by all rows.
+ */
+
++ (NSUInteger)numberOfSkippedCellPropertyWrites;
+
 ///---------------------------------------------
 /// @name Refreshing the Row
 ///---------------------------------------------
@@ -24,6 +24,7 @@
 
 #import "JSMStaticRow.h"
 #import "JSMStaticDataSource.h"
+#import "JSMStaticImageCache.h"
 
 @interface JSMStaticRow ()
 
@@ -31,12 +32,26 @@
 
 @property (nonatomic, getter=isDirty) BOOL dirty;
 
+@property (nonatomic) NSUInteger indexInSection;
+
+@property (nonatomic) CGFloat cachedHeight;
+
+@property (nonatomic) CGFloat cachedHeightWidth;
+
+@property (nonatomic) NSUInteger contentGeneration;
+
+@property (nonatomic, copy) NSString *imageCacheKey;
+
 @end
 
 @interface JSMStaticDataSource (JSMStaticRow)
 
 - (void)requestReloadForRow:(JSMStaticRow *)row;
 
+- (BOOL)tracksVisibleCells;
+
+- (UITableViewCell *)visibleCellForRow:(JSMStaticRow *)row;
+
 @end
 
 @implementation JSMStaticRow
@@ -62,6 +77,7 @@
     if( ( self = [super init] ) ) {
         _key = key;
         _dirty = YES;
+        _indexInSection = NSNotFound;
         _style = UITableViewCellStyleValue1;
         _accessoryType = UITableViewCellAccessoryNone;
         _editingAccessoryType = UITableViewCellAccessoryNone;
@@ -113,6 +129,24 @@
     return self.text.hash ^ self.detailText.hash ^ self.image.hash;
 }
 
+// Rows are equal when their keys match, so this is used to decide if a replacement row looks any different.
+- (BOOL)hasSameContentAsRow:(JSMStaticRow *)row {
+	if( self == row ) {
+		return YES;
+	}
+	else if( self.class != row.class || self.cellClass != row.cellClass || self.configurationBlock != row.configurationBlock ) {
+		return NO;
+	}
+
+	BOOL haveEqualText = ( ! self.text && ! row.text ) || [self.text isEqualToString:row.text];
+	BOOL haveEqualDetailText = ( ! self.detailText && ! row.detailText ) || [self.detailText isEqualToString:row.detailText];
+	BOOL haveEqualImage = ( ! self.image && ! row.image ) || [self.image isEqual:row.image];
+	BOOL haveEqualImageName = ( ! self.imageName && ! row.imageName ) || [self.imageName isEqualToString:row.imageName];
+	BOOL haveEqualStyle = self.style == row.style && self.selectionStyle == row.selectionStyle && CGSizeEqualToSize( self.imageSize, row.imageSize );
+	BOOL haveEqualAccessory = self.accessoryType == row.accessoryType && self.accessoryView == row.accessoryView && self.editingAccessoryType == row.editingAccessoryType && self.editingAccessoryView == row.editingAccessoryView;
+	return haveEqualText && haveEqualDetailText && haveEqualImage && haveEqualImageName && haveEqualStyle && haveEqualAccessory;
+}
+
 #pragma mark - Data Structure
 
 - (UITableView *)tableView {
@@ -130,7 +164,7 @@
  */
 
 - (void)setSection:(JSMStaticSection *)section {
-    if( [_section isEqual:section] ) {
+    if( _section == section ) {
         return;
     }
     if( _section != nil && section != nil) {
@@ -147,10 +181,11 @@
     }
 
 	_text = text;
+	[self invalidateCachedHeight];
 
 	UITableViewCell *cell = self.currentCell;
 	if( cell != nil ) {
-		cell.textLabel.text = text;
+		[JSMStaticRow applyText:text toLabel:cell.textLabel];
 	}
 	else {
 		[self setNeedsReload];
@@ -163,10 +198,11 @@
     }
 
 	_detailText = detailText;
+	[self invalidateCachedHeight];
 
 	UITableViewCell *cell = self.currentCell;
 	if( cell != nil ) {
-		cell.detailTextLabel.text = detailText;
+		[JSMStaticRow applyText:detailText toLabel:cell.detailTextLabel];
 	}
 	else {
 		[self setNeedsReload];
@@ -178,16 +214,35 @@
         return;
     }
     _image = image;
+	[self invalidateCachedHeight];
 
 	UITableViewCell *cell = self.currentCell;
 	if( cell != nil ) {
-		cell.imageView.image = image;
+		[JSMStaticRow applyImage:image toImageView:cell.imageView];
 	}
 	else {
 		[self setNeedsReload];
 	}
 }
 
+- (void)setImageName:(NSString *)imageName {
+    if( _imageName == imageName || [_imageName isEqualToString:imageName] ) {
+        return;
+    }
+    _imageName = [imageName copy];
+    self.imageCacheKey = nil;
+    [self setNeedsReload];
+}
+
+- (void)setImageSize:(CGSize)imageSize {
+    if( CGSizeEqualToSize( _imageSize, imageSize ) ) {
+        return;
+    }
+    _imageSize = imageSize;
+    self.imageCacheKey = nil;
+    [self setNeedsReload];
+}
+
 - (void)setStyle:(UITableViewCellStyle)style {
     if( _style == style ) {
         return;
@@ -203,6 +258,11 @@
 		return nil;
 	}
 
+	// Data sources that are told which cells are on screen can answer without searching for the row.
+	if( self.dataSource.tracksVisibleCells ) {
+		return [self.dataSource visibleCellForRow:self];
+	}
+
 	NSIndexPath *indexPath = [self.dataSource indexPathForRow:self];
 
 	if( self.tableView == nil || indexPath == nil ) {
@@ -222,16 +282,26 @@
 
 - (void)performDefaultConfiguration:(UITableViewCell *)cell {
 	// Apply the content from the row
-	cell.textLabel.text = self.text;
-	cell.detailTextLabel.text = self.detailText;
-	cell.imageView.image = self.image;
+	[JSMStaticRow applyText:self.text toLabel:cell.textLabel];
+	[JSMStaticRow applyText:self.detailText toLabel:cell.detailTextLabel];
+	[JSMStaticRow applyImage:self.imageForCell toImageView:cell.imageView];
 
-	// Reset some basics
-	cell.selectionStyle = self.selectionStyle;
-	cell.accessoryType = self.accessoryType;
-	cell.accessoryView = self.accessoryView;
-	cell.editingAccessoryType = self.editingAccessoryType;
-	cell.editingAccessoryView = self.editingAccessoryView;
+	// Reset some basics, leaving alone anything the cell already shows, as UIKit invalidates layout on every write.
+	if( JSMStaticRowShouldWriteCellProperty( cell.selectionStyle != self.selectionStyle ) ) {
+		cell.selectionStyle = self.selectionStyle;
+	}
+	if( JSMStaticRowShouldWriteCellProperty( cell.accessoryType != self.accessoryType ) ) {
+		cell.accessoryType = self.accessoryType;
+	}
+	if( JSMStaticRowShouldWriteCellProperty( cell.accessoryView != self.accessoryView ) ) {
+		cell.accessoryView = self.accessoryView;
+	}
+	if( JSMStaticRowShouldWriteCellProperty( cell.editingAccessoryType != self.editingAccessoryType ) ) {
+		cell.editingAccessoryType = self.editingAccessoryType;
+	}
+	if( JSMStaticRowShouldWriteCellProperty( cell.editingAccessoryView != self.editingAccessoryView ) ) {
+		cell.editingAccessoryView = self.editingAccessoryView;
+	}
 
 	// Row isn't dirty anymore
 	self.dirty = NO;
@@ -249,6 +319,131 @@
 
 - (void)configurationForCell:(JSMStaticTableViewCellConfiguration)configurationBlock {
     self.configurationBlock = configurationBlock;
+    self.contentGeneration++;
+}
+
+- (BOOL)hasCustomContent {
+	// Subclasses and configuration blocks are free to add their own subviews to the cell.
+	return self.cellClass != nil || self.configurationBlock != nil || ! [self isMemberOfClass:[JSMStaticRow class]];
+}
+
+#pragma mark - Loading Images
+
+- (UIImage *)imageForCell {
+	if( self.image != nil || self.imageName == nil ) {
+		return self.image;
+	}
+
+	// The key is kept, as this is called every time a cell is configured
+	if( self.imageCacheKey == nil ) {
+		self.imageCacheKey = [JSMStaticImageCache keyForImageNamed:self.imageName size:self.imageSize];
+	}
+
+	JSMStaticImageCache *cache = [JSMStaticImageCache sharedCache];
+	UIImage *image = [cache cachedImageForKey:self.imageCacheKey];
+	if( image != nil ) {
+		return image;
+	}
+
+	// Show the image in whichever cell is displaying the row once it has been decoded
+	NSString *imageName = self.imageName;
+	CGSize imageSize = self.imageSize;
+	JSMStaticRow __weak *weakSelf = self;
+	[cache loadImageNamed:imageName size:imageSize completion:^(UIImage *loadedImage) {
+		JSMStaticRow __strong *strongSelf = weakSelf;
+		if( strongSelf == nil || strongSelf.image != nil || ! [strongSelf.imageName isEqualToString:imageName] || ! CGSizeEqualToSize( strongSelf.imageSize, imageSize ) ) {
+			return;
+		}
+
+		UITableViewCell *cell = strongSelf.currentCell;
+		if( cell != nil ) {
+			[JSMStaticRow applyImage:loadedImage toImageView:cell.imageView];
+			[cell setNeedsLayout];
+		}
+	}];
+
+	return nil;
+}
+
+- (void)prefetchImage {
+	if( self.image != nil || self.imageName == nil ) {
+		return;
+	}
+
+	[[JSMStaticImageCache sharedCache] loadImageNamed:self.imageName size:self.imageSize completion:nil];
+}
+
+- (void)cancelPrefetchingImage {
+	if( self.image != nil || self.imageName == nil ) {
+		return;
+	}
+
+	[[JSMStaticImageCache sharedCache] cancelLoadingImageNamed:self.imageName size:self.imageSize];
+}
+
+#pragma mark - Applying Content to the Cell
+
+static NSUInteger _numberOfCellPropertyWrites = 0;
+
+static NSUInteger _numberOfSkippedCellPropertyWrites = 0;
+
+static BOOL JSMStaticRowShouldWriteCellProperty( BOOL differs ) {
+	if( differs ) {
+		_numberOfCellPropertyWrites++;
+	}
+	else {
+		_numberOfSkippedCellPropertyWrites++;
+	}
+	return differs;
+}
+
++ (void)applyText:(NSString *)text toLabel:(UILabel *)label {
+	if( label == nil ) {
+		return;
+	}
+
+	NSString *currentText = label.text;
+	if( JSMStaticRowShouldWriteCellProperty( currentText != text && ! [currentText isEqualToString:text] ) ) {
+		label.text = text;
+	}
+}
+
++ (void)applyImage:(UIImage *)image toImageView:(UIImageView *)imageView {
+	if( imageView == nil ) {
+		return;
+	}
+
+	if( JSMStaticRowShouldWriteCellProperty( imageView.image != image ) ) {
+		imageView.image = image;
+	}
+}
+
++ (NSUInteger)numberOfCellPropertyWrites {
+	return _numberOfCellPropertyWrites;
+}
+
++ (NSUInteger)numberOfSkippedCellPropertyWrites {
+	return _numberOfSkippedCellPropertyWrites;
+}
+
+#pragma mark - Caching the Height
+
+- (BOOL)getCachedHeight:(CGFloat *)height forWidth:(CGFloat)width {
+	if( self.cachedHeightWidth <= 0 || self.cachedHeightWidth != width ) {
+		return NO;
+	}
+
+	*height = self.cachedHeight;
+	return YES;
+}
+
+- (void)setCachedHeight:(CGFloat)height forWidth:(CGFloat)width {
+	self.cachedHeight = height;
+	self.cachedHeightWidth = width;
+}
+
+- (void)invalidateCachedHeight {
+	self.cachedHeightWidth = 0;
 }
 
 #pragma mark - Refreshing the Row
@@ -259,6 +454,8 @@
 
 - (void)setNeedsReload {
 	self.dirty = YES;
+	self.contentGeneration++;
+	[self invalidateCachedHeight];
     // No section or data source
     if( self.section.dataSource == nil ) {
         return;
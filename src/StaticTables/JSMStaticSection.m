@@ -30,20 +30,36 @@
 
 @property (nonatomic, strong) NSMutableArray *mutableRows;
 
+@property (nonatomic, strong) NSMapTable *rowsByKey;
+
 @property (nonatomic, getter=isDirty) BOOL dirty;
 
+@property (nonatomic) NSUInteger indexInDataSource;
+
 @end
 
 @interface JSMStaticDataSource (JSMStaticSection)
 
 - (void)requestReloadForSection:(JSMStaticSection *)section;
 
+- (void)section:(JSMStaticSection *)section didAddRow:(JSMStaticRow *)row;
+
+- (void)section:(JSMStaticSection *)section didRemoveRow:(JSMStaticRow *)row;
+
+- (void)reindex;
+
+- (void)sectionDidChangeRowsDuringBatch:(JSMStaticSection *)section;
+
 @end
 
 @interface JSMStaticRow (JSMStaticSection)
 
 - (void)setSection:(JSMStaticSection *)section;
 
+- (NSUInteger)indexInSection;
+
+- (void)setIndexInSection:(NSUInteger)index;
+
 @end
 
 @implementation JSMStaticSection
@@ -74,7 +90,9 @@
     if( ( self = [super init] ) ) {
         _key = key;
         _dirty = NO;
+        _indexInDataSource = NSNotFound;
         _mutableRows = [NSMutableArray array];
+        _rowsByKey = [NSMapTable strongToStrongObjectsMapTable];
     }
     return self;
 }
@@ -147,7 +165,7 @@
 }
 
 - (void)setDataSource:(JSMStaticDataSource *)dataSource {
-    if( [_dataSource isEqual:dataSource] ) {
+    if( _dataSource == dataSource ) {
         return;
     }
     if( _dataSource != nil && dataSource != nil ) {
@@ -167,7 +185,11 @@
 }
 
 - (JSMStaticRow *)rowWithKey:(id)key {
-	return [[self.mutableRows filteredArrayUsingPredicate:[NSPredicate predicateWithFormat:@"key = %@",key]] firstObject];
+	if( key == nil ) {
+		return nil;
+	}
+
+	return [self.rowsByKey objectForKey:key];
 }
 
 - (JSMStaticRow *)rowAtIndex:(NSUInteger)index {
@@ -179,19 +201,45 @@
 }
 
 - (NSUInteger)indexForRow:(JSMStaticRow *)row {
+	// Rows contained in the receiver know their own index, so we only need to search for rows that don't.
+	NSUInteger index = row.indexInSection;
+	if( row.section == self && index < self.mutableRows.count && self.mutableRows[index] == row ) {
+		return index;
+	}
+
+	if( self.dataSource.usesIdentityComparison ) {
+		return row.section == self ? [self.mutableRows indexOfObjectIdenticalTo:row] : NSNotFound;
+	}
+
 	return [self.mutableRows indexOfObject:row];
 }
 
 - (BOOL)containsRow:(JSMStaticRow *)row {
+	if( row.section == self ) {
+		return YES;
+	}
+
+	if( self.dataSource.usesIdentityComparison ) {
+		return NO;
+	}
+
 	return [self.mutableRows containsObject:row];
 }
 
 #pragma mark - Mutating rows
 
 - (void)setRows:(NSArray *)rows {
-	if( self.mutableRows.count > 0 ) {
+	NSArray *oldRows = self.mutableRows.copy;
+
+	if( oldRows.count > 0 ) {
 		[self.mutableRows makeObjectsPerformSelector:@selector(setSection:) withObject:nil];
 		[self.mutableRows removeAllObjects];
+		[self.rowsByKey removeAllObjects];
+
+		for( JSMStaticRow *row in oldRows ) {
+			row.indexInSection = NSNotFound;
+			[self.dataSource section:self didRemoveRow:row];
+		}
 	}
 	
 	for( JSMStaticRow *row in rows ) {
@@ -200,8 +248,10 @@
 		}
 
 		row.section = self;
+		row.indexInSection = self.mutableRows.count;
 		
 		[self.mutableRows addObject:row];
+		[self indexRow:row];
 	}
 
 	[self rowsDidChange];
@@ -229,8 +279,9 @@
 	NSAssert(index != NSNotFound, @"You cannot insert a row at NSNotFound.");
 
 	// Remove from the existing section
+	NSUInteger firstChangedIndex = index;
 	if( row.section == self ) {
-		NSUInteger oldIndex = [self.mutableRows indexOfObject:row];
+		NSUInteger oldIndex = [self indexForRow:row];
 		
 		if( index == oldIndex || index == oldIndex + 1 ) {
 			return;
@@ -240,6 +291,9 @@
 		}
 
 		[self.mutableRows removeObjectAtIndex:oldIndex];
+		[self unindexRow:row];
+
+		firstChangedIndex = MIN( oldIndex, index );
 	}
 	else if( row.section != nil ) {
 		[row.section removeRow:row];
@@ -253,6 +307,8 @@
     else {
         [self.mutableRows insertObject:row atIndex:index];
     }
+	[self updateRowIndexesFromIndex:MIN( firstChangedIndex, self.mutableRows.count - 1 )];
+	[self indexRow:row];
 	
 	[self rowsDidChange];
 }
@@ -270,7 +326,7 @@
 }
 
 - (void)removeRow:(JSMStaticRow *)row {
-	NSUInteger index = [self.mutableRows indexOfObject:row];
+	NSUInteger index = [self indexForRow:row];
 	
 	if( index == NSNotFound ) {
 		return;
@@ -283,7 +339,10 @@
 	NSAssert(index != NSNotFound, @"You cannot remove a row at NSNotFound.");
 	
 	row.section = nil;
+	row.indexInSection = NSNotFound;
 	[self.mutableRows removeObjectAtIndex:index];
+	[self updateRowIndexesFromIndex:index];
+	[self unindexRow:row];
 	
 	[self rowsDidChange];
 }
@@ -293,15 +352,87 @@
         return;
     }
 
+	NSArray *oldRows = self.mutableRows.copy;
+
 	[self.mutableRows makeObjectsPerformSelector:@selector(setSection:) withObject:nil];
     [self.mutableRows removeAllObjects];
+	[self.rowsByKey removeAllObjects];
+
+	for( JSMStaticRow *row in oldRows ) {
+		row.indexInSection = NSNotFound;
+		[self.dataSource section:self didRemoveRow:row];
+	}
 
 	[self rowsDidChange];
 }
 
 - (void)rowsDidChange {
+	// The data source will call this again once the batch is complete.
+	if( self.dataSource.isPerformingBatchMutations ) {
+		[self.dataSource sectionDidChangeRowsDuringBatch:self];
+		return;
+	}
+
 	if( self.delegate != nil && [self.delegate respondsToSelector:@selector(section:rowsDidChange:)] ) {
 		self.mutableRows = [[self.delegate section:self rowsDidChange:self.mutableRows.copy] mutableCopy];
+
+		// The delegate may have reordered the rows, so the first row for a given key may have changed.
+		[self updateRowIndexesFromIndex:0];
+		[self reindexRows];
+		[self.dataSource reindex];
+	}
+}
+
+#pragma mark - Indexing rows
+
+// Each row keeps track of its own index within the section, so `indexForRow:` doesn't need to search the rows. Any
+// mutation of the `mutableRows` array needs to be followed by updating the index of every row after the mutation.
+
+- (void)updateRowIndexesFromIndex:(NSUInteger)index {
+	NSUInteger count = self.mutableRows.count;
+	for( NSUInteger i = index; i < count; i++ ) {
+		[(JSMStaticRow *)self.mutableRows[i] setIndexInSection:i];
+	}
+}
+
+// Rows are indexed by key so that `rowWithKey:` doesn't need to search the rows. Where more than one row shares a key,
+// only the first is indexed, so these methods should be called *after* the `mutableRows` array has been updated.
+
+- (void)indexRow:(JSMStaticRow *)row {
+	if( row.key != nil ) {
+		JSMStaticRow *indexedRow = [self.rowsByKey objectForKey:row.key];
+
+		if( indexedRow == nil || ( indexedRow != row && row.indexInSection < indexedRow.indexInSection ) ) {
+			[self.rowsByKey setObject:row forKey:row.key];
+		}
+	}
+
+	[self.dataSource section:self didAddRow:row];
+}
+
+- (void)unindexRow:(JSMStaticRow *)row {
+	if( row.key != nil && [self.rowsByKey objectForKey:row.key] == row ) {
+		[self.rowsByKey removeObjectForKey:row.key];
+
+		// Fall back to the next row with the same key, if there is one.
+		for( JSMStaticRow *otherRow in self.mutableRows ) {
+			if( otherRow != row && [otherRow.key isEqual:row.key] ) {
+				[self.rowsByKey setObject:otherRow forKey:row.key];
+				break;
+			}
+		}
+	}
+
+	[self.dataSource section:self didRemoveRow:row];
+}
+
+- (void)reindexRows {
+	[self.rowsByKey removeAllObjects];
+
+	for( JSMStaticRow *row in self.mutableRows ) {
+		if( row.key != nil && [self.rowsByKey objectForKey:row.key] == nil ) {
+			[self.rowsByKey setObject:row forKey:row.key];
+		}
 	}
 }
 
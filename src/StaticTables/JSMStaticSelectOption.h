@@ -0,0 +1,156 @@
+//
+// Copyright © 2019 Daniel Farrelly
+//
+// Redistribution and use in source and binary forms, with or without modification,
+// are permitted provided that the following conditions are met:
+//
+// *	Redistributions of source code must retain the above copyright notice, this list
+//		of conditions and the following disclaimer.
+// *	Redistributions in binary form must reproduce the above copyright notice, this
+//		list of conditions and the following disclaimer in the documentation and/or
+//		other materials provided with the distribution.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+// ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+// WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+// IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+// INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+// BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+// DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+// LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE
+// OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+// ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//
+
+@import UIKit;
+
+NS_ASSUME_NONNULL_BEGIN
+
+/**
+ * Instances of `JSMStaticSelectOption` represent a single option of a `JSMStaticSelectPreference`.
+ *
+ * Options are created by the preference from the dictionaries provided as its `options`, and resolve the label and
+ * image for each value ahead of time, so they can be looked up without searching through the options again.
+ */
+
+@interface JSMStaticSelectOption : NSObject
+
+///---------------------------------------------
+/// @name Creating Options
+///---------------------------------------------
+
+- (instancetype)init NS_UNAVAILABLE;
+
+/**
+ * Initialises an allocated `JSMStaticSelectOption` object from one of a preference's option dictionaries.
+ *
+ * @param dictionary An option dictionary using the keys `JSMStaticSelectOptionValue`, `JSMStaticSelectOptionLabel` and
+ *      `JSMStaticSelectOptionImage`.
+ * @param index The position of the option within the preference's options.
+ * @return Initialised `JSMStaticSelectOption` object, or nil if the dictionary doesn't provide a value.
+ */
+
+- (nullable instancetype)initWithDictionary:(NSDictionary<NSString *,id> *)dictionary index:(NSUInteger)index NS_REFINED_FOR_SWIFT;
+
+/**
+ * Initialises an allocated `JSMStaticSelectOption` object with the given content.
+ *
+ * @param value The value of the option.
+ * @param label The text displayed to the user for the option. If nil, the value is used if it is a string.
+ * @param imageName The name of the icon displayed for the option.
+ * @param index The position of the option within its options.
+ * @return Initialised `JSMStaticSelectOption` object.
+ */
+
+- (instancetype)initWithValue:(id)value label:(nullable NSString *)label imageName:(nullable NSString *)imageName index:(NSUInteger)index NS_DESIGNATED_INITIALIZER NS_SWIFT_NAME(init(value:label:imageName:index:));
+
+///---------------------------------------------
+/// @name Accessing the Option
+///---------------------------------------------
+
+/**
+ * The value of the option.
+ */
+
+@property (nonatomic, strong, readonly) id value;
+
+/**
+ * The text displayed to the user for the option. This is the option's label if one was provided, otherwise the value
+ * is used if it is a string.
+ */
+
+@property (nonatomic, copy, readonly, nullable) NSString *label;
+
+/**
+ * The icon displayed for the option, if it was provided as a `UIImage`.
+ */
+
+@property (nonatomic, strong, readonly, nullable) UIImage *image;
+
+/**
+ * The name of the icon displayed for the option, if it was provided as an `NSString`.
+ *
+ * Named images are loaded through the shared `JSMStaticImageCache` when the option is displayed.
+ */
+
+@property (nonatomic, copy, readonly, nullable) NSString *imageName;
+
+/**
+ * The position of the option within the preference's options.
+ */
+
+@property (nonatomic, readonly) NSUInteger index;
+
+@end
+
+/**
+ * The `JSMStaticSelectOptionSource` protocol provides the options for a `JSMStaticSelectPreference` one at a time, so
+ * very large sets of options don't need to be held in memory, or turned into rows, all at once.
+ *
+ * @see JSMStaticFileOptionSource
+ */
+
+NS_SWIFT_NAME(JSMStaticSelectOption.Source)
+@protocol JSMStaticSelectOptionSource <NSObject>
+
+/**
+ * The number of options provided by the source.
+ */
+
+@property (nonatomic, readonly) NSUInteger numberOfOptions;
+
+/**
+ * Returns the option at the given position.
+ *
+ * @param index The position of the option, which must be less than `numberOfOptions`.
+ * @return The option at the given position.
+ */
+
+- (JSMStaticSelectOption *)optionAtIndex:(NSUInteger)index NS_SWIFT_NAME(option(at:));
+
+/**
+ * Returns the position of the first option with the given value.
+ *
+ * @param value The value to look for.
+ * @return The position of the option, or `NSNotFound` if there isn't one.
+ */
+
+- (NSUInteger)indexOfOptionWithValue:(id)value NS_SWIFT_NAME(indexOfOption(with:));
+
+@optional
+
+/**
+ * Returns the label of the option at the given position, without creating the option.
+ *
+ * This is used to build the search index for a searchable picker, and is called from a background queue. Sources that
+ * don't implement it have their labels read with `optionAtIndex:` on the main queue instead.
+ *
+ * @param index The position of the option, which must be less than `numberOfOptions`.
+ * @return The label of the option at the given position.
+ */
+
+- (nullable NSString *)labelAtIndex:(NSUInteger)index NS_SWIFT_NAME(label(at:));
+
+@end
+
+NS_ASSUME_NONNULL_END
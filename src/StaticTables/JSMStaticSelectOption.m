@@ -0,0 +1,68 @@
+//
+// Copyright © 2019 Daniel Farrelly
+//
+// Redistribution and use in source and binary forms, with or without modification,
+// are permitted provided that the following conditions are met:
+//
+// *	Redistributions of source code must retain the above copyright notice, this list
+//		of conditions and the following disclaimer.
+// *	Redistributions in binary form must reproduce the above copyright notice, this
+//		list of conditions and the following disclaimer in the documentation and/or
+//		other materials provided with the distribution.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+// ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+// WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+// IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+// INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+// BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+// DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+// LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE
+// OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+// ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//
+
+#import "JSMStaticSelectOption.h"
+#import "JSMStaticSelectPreference.h"
+
+@implementation JSMStaticSelectOption
+
+#pragma mark - Creating Options
+
+- (instancetype)initWithDictionary:(NSDictionary<NSString *,id> *)dictionary index:(NSUInteger)index {
+    if( ! [dictionary isKindOfClass:[NSDictionary class]] || dictionary[JSMStaticSelectOptionValue] == nil ) {
+        return nil;
+    }
+
+    id label = dictionary[JSMStaticSelectOptionLabel];
+    id image = dictionary[JSMStaticSelectOptionImage];
+
+    if( ( self = [self initWithValue:dictionary[JSMStaticSelectOptionValue] label:( [label isKindOfClass:[NSString class]] ? label : nil ) imageName:( [image isKindOfClass:[NSString class]] ? image : nil ) index:index] ) ) {
+        if( [image isKindOfClass:[UIImage class]] ) {
+            _image = (UIImage *)image;
+        }
+    }
+    return self;
+}
+
+- (instancetype)initWithValue:(id)value label:(NSString *)label imageName:(NSString *)imageName index:(NSUInteger)index {
+    if( ( self = [super init] ) ) {
+        _value = value;
+        _index = index;
+        _imageName = [imageName copy];
+
+        if( label != nil ) {
+            _label = [label copy];
+        }
+        else if( [value isKindOfClass:[NSString class]] ) {
+            _label = [(NSString *)value copy];
+        }
+    }
+    return self;
+}
+
+- (NSString *)description {
+    return [NSString stringWithFormat:@"<%@: value='%@'; label='%@'; index=%lu>",self.class,self.value,self.label,(unsigned long)self.index];
+}
+
+@end
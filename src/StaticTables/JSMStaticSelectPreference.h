@@ -23,6 +23,7 @@
 //
 
 #import "JSMStaticPreference.h"
+#import "JSMStaticSelectOption.h"
 
 NS_ASSUME_NONNULL_BEGIN
 
@@ -90,6 +91,34 @@ extern NSString *const JSMStaticSelectOptionImage NS_REFINED_FOR_SWIFT;
 
 @property (nonatomic, copy) NSArray<NSDictionary<NSString *,id> *> *options NS_REFINED_FOR_SWIFT;
 
+/**
+ * An object that provides the options for the preference one at a time. When set, this is used instead of `options`.
+ *
+ * A source allows very large sets of options to be used without holding them all in memory, and the preference's
+ * view controller displays them without creating a row for each option.
+ */
+
+@property (nonatomic, strong, nullable) id<JSMStaticSelectOptionSource> optionSource;
+
+/**
+ * The size that images provided by name are scaled down to fit within when the options are displayed. Defaults to
+ * `CGSizeZero`, which keeps the images at their original size.
+ */
+
+@property (nonatomic) CGSize optionImageSize;
+
+/**
+ * Returns the option for the given value.
+ *
+ * Options are indexed by value when `options` is set, so this doesn't need to search through them. If more than one
+ * option has the same value, the first is returned. If an `optionSource` is set, the option is provided by it instead.
+ *
+ * @param value The value of the option to retrieve.
+ * @return The option with the given value, or nil if there isn't one.
+ */
+
+- (nullable JSMStaticSelectOption *)optionForValue:(nullable id)value NS_SWIFT_NAME(option(for:));
+
 ///---------------------------------------------
 /// @name User Interface
 ///---------------------------------------------
@@ -24,6 +24,7 @@
 
 #import "JSMStaticSelectPreference.h"
 #import "JSMStaticSelectPreferenceViewController.h"
+#import "JSMStaticSelectOption.h"
 
 NSString *const JSMStaticSelectOptionValue = @"JSMStaticSelectOptionValue";
 
@@ -31,6 +32,14 @@ NSString *const JSMStaticSelectOptionLabel = @"JSMStaticSelectOptionLabel";
 
 NSString *const JSMStaticSelectOptionImage = @"JSMStaticSelectOptionImage";
 
+@interface JSMStaticSelectPreference ()
+
+@property (nonatomic, copy) NSArray<JSMStaticSelectOption *> *selectOptions;
+
+@property (nonatomic, strong) NSMapTable *optionsByValue;
+
+@end
+
 @implementation JSMStaticSelectPreference
 
 @dynamic value;
@@ -44,6 +53,8 @@ NSString *const JSMStaticSelectOptionImage = @"JSMStaticSelectOptionImage";
         self.style = UITableViewCellStyleValue1;
         self.detailText = [self labelForValue:self.value];
         _options = @[];
+        _selectOptions = @[];
+        _optionsByValue = [NSMapTable strongToStrongObjectsMapTable];
     }
     
     return self;
@@ -78,6 +89,51 @@ NSString *const JSMStaticSelectOptionImage = @"JSMStaticSelectOptionImage";
     _viewController = nil;
 }
 
+#pragma mark - Options
+
+- (void)setOptions:(NSArray<NSDictionary<NSString *,id> *> *)options {
+    _options = [options copy];
+
+    // Index the options by value, so labels and the default value don't need a search.
+    NSMutableArray *selectOptions = [NSMutableArray arrayWithCapacity:_options.count];
+    NSMapTable *optionsByValue = [NSMapTable strongToStrongObjectsMapTable];
+    [_options enumerateObjectsUsingBlock:^(NSDictionary *dictionary, NSUInteger idx, BOOL *stop) {
+        JSMStaticSelectOption *option = [[JSMStaticSelectOption alloc] initWithDictionary:dictionary index:idx];
+        if( option == nil ) {
+            return;
+        }
+
+        [selectOptions addObject:option];
+
+        // The first option with a given value wins
+        if( [optionsByValue objectForKey:option.value] == nil ) {
+            [optionsByValue setObject:option forKey:option.value];
+        }
+    }];
+    self.selectOptions = selectOptions;
+    self.optionsByValue = optionsByValue;
+
+    [self setNeedsReload];
+}
+
+- (void)setOptionSource:(id<JSMStaticSelectOptionSource>)optionSource {
+    _optionSource = optionSource;
+    [self setNeedsReload];
+}
+
+- (JSMStaticSelectOption *)optionForValue:(id)value {
+    if( value == nil ) {
+        return nil;
+    }
+
+    if( self.optionSource != nil ) {
+        NSUInteger index = [self.optionSource indexOfOptionWithValue:value];
+        return index != NSNotFound ? [self.optionSource optionAtIndex:index] : nil;
+    }
+
+    return [self.optionsByValue objectForKey:value];
+}
+
 - (BOOL)fitControlToCell {
     return NO;
 }
@@ -92,19 +148,17 @@ NSString *const JSMStaticSelectOptionImage = @"JSMStaticSelectOptionImage";
 - (id)defaultValue {
     // If we haven't been given a value, use the first valid option.
     if( super.defaultValue == nil ) {
-        return [[self.options filteredArrayUsingPredicate:[NSPredicate predicateWithBlock:^BOOL(NSDictionary *option, NSDictionary *bindings) {
-            return ( [option isKindOfClass:[NSDictionary class]] && option[JSMStaticSelectOptionValue] != nil );
-        }]] firstObject][JSMStaticSelectOptionValue];
+        if( self.optionSource != nil ) {
+            return self.optionSource.numberOfOptions > 0 ? [self.optionSource optionAtIndex:0].value : nil;
+        }
+        return self.selectOptions.firstObject.value;
     }
     // Return the value
     return super.defaultValue;
 }
 
 - (NSString *)labelForValue:(NSString *)value {
-    NSDictionary *option = [[self.options filteredArrayUsingPredicate:[NSPredicate predicateWithBlock:^BOOL(NSDictionary *_option, NSDictionary *bindings) {
-        return ( [_option isKindOfClass:[NSDictionary class]] && [_option[JSMStaticSelectOptionValue] isEqual:value] );
-    }]] firstObject];
-    return option[JSMStaticSelectOptionLabel] ?: option[JSMStaticSelectOptionValue];
+    return [self optionForValue:value].label;
 }
 
 - (void)valueDidChange {
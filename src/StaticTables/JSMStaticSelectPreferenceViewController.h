@@ -60,6 +60,19 @@ NS_ASSUME_NONNULL_BEGIN
 
 @property (nonatomic, weak) __kindof JSMStaticSelectPreference *preference;
 
+///---------------------------------------------
+/// @name Searching Options
+///---------------------------------------------
+
+/**
+ * Flag that indicates whether a search field is shown in the navigation bar to filter the options. Defaults to `NO`.
+ *
+ * Options are matched when any word in their label starts with the search text, ignoring case and diacritics. This
+ * needs to be set before the view is loaded.
+ */
+
+@property (nonatomic, getter=isSearchable) BOOL searchable;
+
 @end
 
 NS_ASSUME_NONNULL_END
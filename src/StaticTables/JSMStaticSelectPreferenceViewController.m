@@ -24,20 +24,54 @@
 
 #import "JSMStaticSelectPreferenceViewController.h"
 #import "JSMStaticSelectPreference.h"
+#import "JSMStaticSelectOption.h"
 #import "JSMStaticDataSource.h"
+#import "JSMStaticDataSource+Convenience.h"
+#import "JSMStaticImageCache.h"
 
-@interface JSMStaticSelectPreferenceViewController ()
+static NSString *const JSMStaticSelectOptionReuseIdentifier = @"JSMStaticSelectOptionReuseIdentifier";
+
+@interface JSMStaticSelectSearchIndex : NSObject
+
+- (instancetype)initWithLabels:(NSArray *)labels;
+
+- (NSIndexSet *)indexesMatchingQuery:(NSString *)query withinIndexes:(NSIndexSet *)indexes;
+
++ (NSString *)normalizedString:(NSString *)string;
+
+@end
+
+@interface JSMStaticSelectPreferenceViewController () <UISearchResultsUpdating, UITableViewDataSource, UITableViewDataSourcePrefetching>
 
 @property (nonatomic, strong) JSMStaticSection *section;
 
 @property (nonatomic, strong) NSMutableDictionary *rows;
 
+@property (nonatomic, copy) NSArray<JSMStaticRow *> *allRows;
+
+@property (nonatomic, strong) UISearchController *searchController;
+
+@property (nonatomic, strong) JSMStaticSelectSearchIndex *searchIndex;
+
+@property (nonatomic, getter=isBuildingSearchIndex) BOOL buildingSearchIndex;
+
+@property (nonatomic, copy) NSString *searchQuery;
+
+@property (nonatomic, strong) NSIndexSet *searchResults;
+
+@property (nonatomic, strong) id<JSMStaticSelectOptionSource> optionSource;
+
+// Positions of the options matching the search, in ascending order.
+@property (nonatomic, strong) NSData *optionSourceResults;
+
 @end
 
 @interface JSMStaticSelectPreference (JSMStaticSelectPreferenceViewController)
 
 - (void)clearViewController;
 
+- (NSArray<JSMStaticSelectOption *> *)selectOptions;
+
 @end
 
 @implementation JSMStaticSelectPreferenceViewController
@@ -64,28 +98,28 @@
     self.section = [JSMStaticSection section];
     [self.dataSource addSection:self.section];
 
-    // Prepare the section with the preference's options
-    [self.preference.options enumerateObjectsUsingBlock:^(NSDictionary *option, NSUInteger idx, BOOL *stop) {
-        if( ! [option isKindOfClass:[NSDictionary class]] || option[JSMStaticSelectOptionValue] == nil ) {
-            return;
-        }
+    // Large sets of options are displayed straight from their source, rather than creating a row for each
+    self.optionSource = self.preference.optionSource;
+    if( self.optionSource != nil ) {
+        self.tableView.dataSource = self;
+        self.tableView.prefetchDataSource = self;
 
-        id optionValue = option[JSMStaticSelectOptionValue];
-        JSMStaticRow *row = [JSMStaticRow rowWithKey:option[JSMStaticSelectOptionValue]];
-        row.style = UITableViewCellStyleSubtitle;
-
-        id optionLabel = option[JSMStaticSelectOptionLabel] ?: optionValue;
-        if( [optionLabel isKindOfClass:[NSString class]] ) {
-            row.text = (NSString *)optionLabel;
+        if( self.isSearchable ) {
+            [self prepareSearchController];
         }
+        return;
+    }
 
-        id optionImage = option[JSMStaticSelectOptionImage];
-        if( [optionImage isKindOfClass:[NSString class]] ) {
-            row.image = [UIImage imageNamed:(NSString *)optionImage];
-        }
-        else if( [optionImage isKindOfClass:[UIImage class]] ) {
-            row.image = (UIImage *)optionImage;
-        }
+    // Prepare the section with the preference's options
+    NSMutableArray *allRows = [NSMutableArray array];
+    for( JSMStaticSelectOption *option in self.preference.selectOptions ) {
+        id optionValue = option.value;
+        JSMStaticRow *row = [JSMStaticRow rowWithKey:optionValue];
+        row.style = UITableViewCellStyleSubtitle;
+        row.text = option.label;
+        row.image = option.image;
+        row.imageName = option.imageName;
+        row.imageSize = self.preference.optionImageSize;
 
         // We place a checkmark on the selected option
         JSMStaticSelectPreferenceViewController __weak *weakSelf = self;
@@ -101,8 +135,14 @@
 
         // Add to the section
 		self.rows[optionValue] = row;
+        [allRows addObject:row];
         [self.section addRow:row];
-    }];
+    }
+    self.allRows = allRows;
+
+    if( self.isSearchable ) {
+        [self prepareSearchController];
+    }
 }
 
 - (void)viewWillAppear:(BOOL)animated {
@@ -124,8 +164,14 @@
 - (void)tableView:(UITableView *)tableView didSelectRowAtIndexPath:(NSIndexPath *)indexPath {
     // Deselect the row
     [tableView deselectRowAtIndexPath:indexPath animated:YES];
+    // Options from a source don't have rows
+    if( self.optionSource != nil ) {
+        [self selectOptionSourceRowAtIndexPath:indexPath];
+        return;
+    }
     // Find the rows for the existing and new values
     JSMStaticRow *oldRow = self.rows[self.preference.value];
+    NSIndexPath *oldIndexPath = oldRow != nil ? [self.dataSource indexPathForRow:oldRow] : nil;
     JSMStaticRow *newRow = [self.dataSource rowAtIndexPath:indexPath];
     // If the rows are actually one and the same, stop right now.
     if( [oldRow isEqual:newRow] ) {
@@ -133,9 +179,9 @@
     }
     // We're going to perform some updates
     [tableView beginUpdates];
-    // Find the row that is checked and reload it
-    if( oldRow != nil ) {
-        [tableView reloadRowsAtIndexPaths:@[[self.dataSource indexPathForRow:oldRow]] withRowAnimation:UITableViewRowAnimationFade];
+    // Find the row that is checked and reload it, unless a search has filtered it out
+    if( oldIndexPath != nil ) {
+        [tableView reloadRowsAtIndexPaths:@[oldIndexPath] withRowAnimation:UITableViewRowAnimationFade];
     }
     // Fetch the row for the option we are going to select and reload it
     self.preference.value = newRow.key;
@@ -144,4 +190,296 @@
     [tableView endUpdates];
 }
 
+#pragma mark - Displaying Options from a Source
+
+- (NSUInteger)optionSourceIndexForIndexPath:(NSIndexPath *)indexPath {
+    if( self.optionSourceResults != nil ) {
+        return ((const NSUInteger *)self.optionSourceResults.bytes)[(NSUInteger)indexPath.row];
+    }
+    return (NSUInteger)indexPath.row;
+}
+
+- (NSIndexPath *)indexPathForOptionSourceIndex:(NSUInteger)index {
+    if( index == NSNotFound ) {
+        return nil;
+    }
+
+    if( self.optionSourceResults != nil ) {
+        const NSUInteger *results = self.optionSourceResults.bytes;
+        NSUInteger lower = 0;
+        NSUInteger upper = self.optionSourceResults.length / sizeof(NSUInteger);
+        while( lower < upper ) {
+            NSUInteger middle = lower + ( upper - lower ) / 2;
+            if( results[middle] < index ) {
+                lower = middle + 1;
+            }
+            else {
+                upper = middle;
+            }
+        }
+
+        if( lower == self.optionSourceResults.length / sizeof(NSUInteger) || results[lower] != index ) {
+            return nil;
+        }
+        index = lower;
+    }
+
+    return [NSIndexPath indexPathForRow:(NSInteger)index inSection:0];
+}
+
+- (void)selectOptionSourceRowAtIndexPath:(NSIndexPath *)indexPath {
+    JSMStaticSelectOption *option = [self.optionSource optionAtIndex:[self optionSourceIndexForIndexPath:indexPath]];
+    if( [option.value isEqual:self.preference.value] ) {
+        return;
+    }
+
+    NSIndexPath *oldIndexPath = self.preference.value != nil ? [self indexPathForOptionSourceIndex:[self.optionSource indexOfOptionWithValue:self.preference.value]] : nil;
+    self.preference.value = option.value;
+
+    NSMutableArray *indexPaths = [NSMutableArray arrayWithObject:indexPath];
+    if( oldIndexPath != nil ) {
+        [indexPaths addObject:oldIndexPath];
+    }
+    [self.tableView reloadRowsAtIndexPaths:indexPaths withRowAnimation:UITableViewRowAnimationFade];
+}
+
+- (NSInteger)numberOfSectionsInTableView:(UITableView *)tableView {
+    return 1;
+}
+
+- (NSInteger)tableView:(UITableView *)tableView numberOfRowsInSection:(NSInteger)section {
+    if( self.optionSourceResults != nil ) {
+        return (NSInteger)( self.optionSourceResults.length / sizeof(NSUInteger) );
+    }
+    return (NSInteger)self.optionSource.numberOfOptions;
+}
+
+- (UITableViewCell *)tableView:(UITableView *)tableView cellForRowAtIndexPath:(NSIndexPath *)indexPath {
+    UITableViewCell *cell = [tableView dequeueReusableCellWithIdentifier:JSMStaticSelectOptionReuseIdentifier];
+    if( cell == nil ) {
+        cell = [[UITableViewCell alloc] initWithStyle:UITableViewCellStyleSubtitle reuseIdentifier:JSMStaticSelectOptionReuseIdentifier];
+    }
+
+    JSMStaticSelectOption *option = [self.optionSource optionAtIndex:[self optionSourceIndexForIndexPath:indexPath]];
+    cell.textLabel.text = option.label;
+    cell.accessoryType = [self.preference.value isEqual:option.value] ? UITableViewCellAccessoryCheckmark : UITableViewCellAccessoryNone;
+
+    UIImage *image = option.image;
+    if( image == nil && option.imageName != nil ) {
+        JSMStaticImageCache *cache = [JSMStaticImageCache sharedCache];
+        image = [cache cachedImageNamed:option.imageName size:self.preference.optionImageSize];
+        if( image == nil ) {
+            // Reload the row once the image is ready, if it's still showing the same option
+            JSMStaticSelectPreferenceViewController __weak *weakSelf = self;
+            NSUInteger index = option.index;
+            [cache loadImageNamed:option.imageName size:self.preference.optionImageSize completion:^(UIImage *loadedImage) {
+                JSMStaticSelectPreferenceViewController __strong *strongSelf = weakSelf;
+                NSIndexPath *currentIndexPath = [strongSelf indexPathForOptionSourceIndex:index];
+                if( loadedImage != nil && currentIndexPath != nil && [strongSelf.tableView.indexPathsForVisibleRows containsObject:currentIndexPath] ) {
+                    [strongSelf.tableView reloadRowsAtIndexPaths:@[currentIndexPath] withRowAnimation:UITableViewRowAnimationNone];
+                }
+            }];
+        }
+    }
+    cell.imageView.image = image;
+
+    return cell;
+}
+
+- (void)tableView:(UITableView *)tableView prefetchRowsAtIndexPaths:(NSArray<NSIndexPath *> *)indexPaths {
+    for( NSIndexPath *indexPath in indexPaths ) {
+        JSMStaticSelectOption *option = [self.optionSource optionAtIndex:[self optionSourceIndexForIndexPath:indexPath]];
+        if( option.image == nil && option.imageName != nil ) {
+            [[JSMStaticImageCache sharedCache] loadImageNamed:option.imageName size:self.preference.optionImageSize completion:nil];
+        }
+    }
+}
+
+#pragma mark - Searching
+
+- (void)prepareSearchController {
+    self.searchController = [[UISearchController alloc] initWithSearchResultsController:nil];
+    self.searchController.searchResultsUpdater = self;
+    self.searchController.obscuresBackgroundDuringPresentation = NO;
+    self.navigationItem.searchController = self.searchController;
+    self.navigationItem.hidesSearchBarWhenScrolling = NO;
+    self.definesPresentationContext = YES;
+}
+
+// The index isn't needed until something is searched for, and is built in the background as it can take a while.
+- (void)buildSearchIndex {
+    if( self.isBuildingSearchIndex ) {
+        return;
+    }
+    self.buildingSearchIndex = YES;
+
+    id<JSMStaticSelectOptionSource> optionSource = self.optionSource;
+    NSArray *labels = nil;
+    if( optionSource == nil || ! [optionSource respondsToSelector:@selector(labelAtIndex:)] ) {
+        NSMutableArray *mutableLabels = [NSMutableArray array];
+        if( optionSource != nil ) {
+            for( NSUInteger index = 0; index < optionSource.numberOfOptions; index++ ) {
+                [mutableLabels addObject:[optionSource optionAtIndex:index].label ?: @""];
+            }
+        }
+        else {
+            for( JSMStaticRow *row in self.allRows ) {
+                [mutableLabels addObject:row.text ?: @""];
+            }
+        }
+        labels = mutableLabels;
+    }
+
+    JSMStaticSelectPreferenceViewController __weak *weakSelf = self;
+    dispatch_async(dispatch_get_global_queue(QOS_CLASS_USER_INITIATED, 0), ^{
+        NSArray *indexedLabels = labels;
+        if( indexedLabels == nil ) {
+            NSUInteger count = optionSource.numberOfOptions;
+            NSMutableArray *mutableLabels = [NSMutableArray arrayWithCapacity:count];
+            for( NSUInteger index = 0; index < count; index++ ) {
+                [mutableLabels addObject:[optionSource labelAtIndex:index] ?: @""];
+            }
+            indexedLabels = mutableLabels;
+        }
+
+        JSMStaticSelectSearchIndex *searchIndex = [[JSMStaticSelectSearchIndex alloc] initWithLabels:indexedLabels];
+        dispatch_async(dispatch_get_main_queue(), ^{
+            JSMStaticSelectPreferenceViewController __strong *strongSelf = weakSelf;
+            strongSelf.searchIndex = searchIndex;
+            strongSelf.buildingSearchIndex = NO;
+            [strongSelf updateSearchResultsForSearchController:strongSelf.searchController];
+        });
+    });
+}
+
+- (void)updateSearchResultsForSearchController:(UISearchController *)searchController {
+    NSString *query = [JSMStaticSelectSearchIndex normalizedString:searchController.searchBar.text ?: @""];
+    if( [query isEqualToString:self.searchQuery ?: @""] ) {
+        return;
+    }
+
+    // Results are updated once the index is ready
+    if( query.length > 0 && self.searchIndex == nil ) {
+        [self buildSearchIndex];
+        return;
+    }
+
+    NSIndexSet *results = nil;
+    if( query.length > 0 ) {
+        // Refining the query can only remove results, so only the previous results need to be checked.
+        NSIndexSet *previousResults = nil;
+        if( self.searchQuery.length > 0 && [query hasPrefix:self.searchQuery] ) {
+            previousResults = self.searchResults;
+        }
+        results = [self.searchIndex indexesMatchingQuery:query withinIndexes:previousResults];
+    }
+
+    self.searchQuery = query;
+    self.searchResults = results;
+
+    // Without rows there's nothing to compare, so the results are simply reloaded
+    if( self.optionSource != nil ) {
+        NSMutableData *optionSourceResults = nil;
+        if( results != nil ) {
+            optionSourceResults = [NSMutableData dataWithLength:results.count * sizeof(NSUInteger)];
+            [results getIndexes:optionSourceResults.mutableBytes maxCount:results.count inIndexRange:nil];
+        }
+        self.optionSourceResults = optionSourceResults;
+        [self.tableView reloadData];
+        return;
+    }
+
+    NSArray *rows = results != nil ? [self.allRows objectsAtIndexes:results] : self.allRows;
+    [self.dataSource setRows:rows forSection:self.section withRowAnimation:UITableViewRowAnimationFade];
+}
+
+@end
+
+@interface JSMStaticSelectSearchIndex ()
+
+@property (nonatomic, copy) NSArray<NSArray<NSString *> *> *tokensByPosition;
+
+@property (nonatomic, copy) NSArray<NSString *> *sortedTokens;
+
+@property (nonatomic, copy) NSArray<NSNumber *> *sortedPositions;
+
+@end
+
+@implementation JSMStaticSelectSearchIndex
+
+- (instancetype)initWithLabels:(NSArray *)labels {
+    if( ( self = [super init] ) ) {
+        NSMutableArray *tokensByPosition = [NSMutableArray arrayWithCapacity:labels.count];
+        NSMutableArray *entries = [NSMutableArray array];
+
+        [labels enumerateObjectsUsingBlock:^(NSString *label, NSUInteger idx, BOOL *stop) {
+            // Each word starts a token running to the end of the label, so queries can match from any word.
+            NSArray *words = [[JSMStaticSelectSearchIndex normalizedString:label] componentsSeparatedByString:@" "];
+            NSMutableArray *tokens = [NSMutableArray arrayWithCapacity:words.count];
+            for( NSUInteger i = 0; i < words.count; i++ ) {
+                NSString *token = [[words subarrayWithRange:NSMakeRange(i, words.count - i)] componentsJoinedByString:@" "];
+                if( token.length == 0 ) {
+                    continue;
+                }
+                [tokens addObject:token];
+                [entries addObject:@[ token, @(idx) ]];
+            }
+            [tokensByPosition addObject:tokens];
+        }];
+
+        [entries sortUsingComparator:^NSComparisonResult(NSArray *entry, NSArray *otherEntry) {
+            return [(NSString *)entry[0] compare:otherEntry[0] options:NSLiteralSearch];
+        }];
+
+        NSMutableArray *sortedTokens = [NSMutableArray arrayWithCapacity:entries.count];
+        NSMutableArray *sortedPositions = [NSMutableArray arrayWithCapacity:entries.count];
+        for( NSArray *entry in entries ) {
+            [sortedTokens addObject:entry[0]];
+            [sortedPositions addObject:entry[1]];
+        }
+
+        _tokensByPosition = tokensByPosition;
+        _sortedTokens = sortedTokens;
+        _sortedPositions = sortedPositions;
+    }
+    return self;
+}
+
+- (NSIndexSet *)indexesMatchingQuery:(NSString *)query withinIndexes:(NSIndexSet *)indexes {
+    NSMutableIndexSet *matches = [NSMutableIndexSet indexSet];
+
+    // Narrow down an existing set of results by checking only their tokens
+    if( indexes != nil ) {
+        [indexes enumerateIndexesUsingBlock:^(NSUInteger idx, BOOL *stop) {
+            for( NSString *token in self.tokensByPosition[idx] ) {
+                if( [token hasPrefix:query] ) {
+                    [matches addIndex:idx];
+                    break;
+                }
+            }
+        }];
+        return matches;
+    }
+
+    // Otherwise, tokens sharing the prefix sit together in the sorted tokens, starting where the query would be inserted.
+    NSUInteger index = [self.sortedTokens indexOfObject:query inSortedRange:NSMakeRange(0, self.sortedTokens.count) options:NSBinarySearchingInsertionIndex|NSBinarySearchingFirstEqual usingComparator:^NSComparisonResult(NSString *token, NSString *otherToken) {
+        return [token compare:otherToken options:NSLiteralSearch];
+    }];
+    for( ; index < self.sortedTokens.count && [self.sortedTokens[index] hasPrefix:query]; index++ ) {
+        [matches addIndex:self.sortedPositions[index].unsignedIntegerValue];
+    }
+    return matches;
+}
+
++ (NSString *)normalizedString:(NSString *)string {
+    NSString *foldedString = [string stringByFoldingWithOptions:NSCaseInsensitiveSearch|NSDiacriticInsensitiveSearch|NSWidthInsensitiveSearch locale:nil];
+    NSMutableArray *words = [NSMutableArray array];
+    for( NSString *word in [foldedString componentsSeparatedByCharactersInSet:[NSCharacterSet alphanumericCharacterSet].invertedSet] ) {
+        if( word.length > 0 ) {
+            [words addObject:word];
+        }
+    }
+    return [words componentsJoinedByString:@" "];
+}
+
 @end
@@ -52,7 +52,8 @@ NS_ASSUME_NONNULL_BEGIN
 /**
  * The value of the preference.
  *
- * This will return the `defaultValue` if it is set to nil, or if no value has been provided yet.
+ * This will return the `defaultValue` if it is set to nil, or if no value has been provided yet. The value is stored
+ * as a scalar, so this is cheaper to use than `value`.
  */
 
 @property (nonatomic) CGFloat floatValue;
@@ -85,6 +86,36 @@ NS_ASSUME_NONNULL_BEGIN
 
 @property (nonatomic, weak, readonly) UISlider *slider;
 
+///---------------------------------------------
+/// @name Throttling Updates
+///---------------------------------------------
+
+/**
+ * The minimum number of seconds between updates of the value while the slider is being dragged. Defaults to 0.
+ *
+ * By default, every movement of the slider is stored as the value. If this is greater than 0, observers are instead
+ * sent the live value at most once per interval while the slider is dragged, and the value is only written to storage
+ * once the drag ends. During the drag, `value` returns the live value.
+ */
+
+@property (nonatomic) NSTimeInterval continuousUpdateInterval;
+
+/**
+ * Block called with the slider's value every time it changes, without waiting for `continuousUpdateInterval`.
+ *
+ * This is intended for keeping other parts of the interface in step with the slider, such as a label showing the
+ * current value, and should be kept cheap.
+ */
+
+@property (nonatomic, copy, nullable) void (^sliderValueHandler)(JSMStaticSliderPreference *preference, float value);
+
+/**
+ * The number of changes during the most recent drag that weren't written to storage because of
+ * `continuousUpdateInterval`.
+ */
+
+@property (nonatomic, readonly) NSUInteger numberOfCommitsSaved;
+
 @end
 
 NS_ASSUME_NONNULL_END
@@ -24,6 +24,30 @@
 
 #import "JSMStaticSliderPreference.h"
 
+@interface JSMStaticSliderPreference ()
+
+@property (nonatomic) float liveValue;
+
+@property (nonatomic) BOOL hasLiveValue;
+
+@property (nonatomic) float latestSliderValue;
+
+@property (nonatomic) CFTimeInterval lastLiveUpdateTime;
+
+@property (nonatomic, getter=isLiveUpdateScheduled) BOOL liveUpdateScheduled;
+
+@property (nonatomic, readwrite) NSUInteger numberOfCommitsSaved;
+
+@end
+
+@interface JSMStaticPreference (JSMStaticSliderPreference)
+
+- (void)_valueWillChange;
+
+- (void)_valueDidChange;
+
+@end
+
 @implementation JSMStaticSliderPreference
 
 @dynamic value;
@@ -32,25 +56,57 @@
 #pragma mark - User Interface
 
 - (void)loadControl {
-	UISlider *slider = [[UISlider alloc] init];
-	slider.value = (float)self.floatValue;
-	[slider addTarget:self action:@selector(sliderChanged:) forControlEvents:UIControlEventValueChanged];
+	super.control = (UIControl *)[[UISlider alloc] init];
+}
 
-	super.control = (UIControl *)slider;
+- (void)controlDidLoad {
+	[super controlDidLoad];
+
+	self.slider.value = (float)self.floatValue;
+	[self.slider addTarget:self action:@selector(sliderChanged:) forControlEvents:UIControlEventValueChanged];
+	[self.slider addTarget:self action:@selector(sliderDidEndTracking:) forControlEvents:UIControlEventTouchUpInside|UIControlEventTouchUpOutside|UIControlEventTouchCancel];
+}
+
+- (void)controlWillBeRecycled {
+	[super controlWillBeRecycled];
+
+	self.hasLiveValue = NO;
+	if( self.slider.value < (float)self.floatValue || self.slider.value > (float)self.floatValue ) {
+		self.floatValue = self.slider.value;
+	}
 }
 
 - (UISlider *)slider {
     return (UISlider *)self.control;
 }
 
++ (CGSize)controlSize {
+	return CGSizeMake( 0, 31 );
+}
+
 #pragma mark - Updating the value
 
+- (NSNumber *)value {
+	// While the slider is being dragged, the live value hasn't been stored yet
+	if( self.hasLiveValue ) {
+		return @(self.liveValue);
+	}
+	return super.value;
+}
+
+- (double)scalarDoubleValue {
+	if( self.hasLiveValue ) {
+		return self.liveValue;
+	}
+	return super.scalarDoubleValue;
+}
+
 - (CGFloat)floatValue {
-    return self.value.floatValue;
+    return (CGFloat)self.scalarDoubleValue;
 }
 
 - (void)setFloatValue:(CGFloat)floatValue {
-    self.value = @(floatValue);
+    self.scalarDoubleValue = floatValue;
 }
 
 - (void)valueDidChange {
@@ -62,7 +118,75 @@
 #pragma mark - Event Handling
 
 - (void)sliderChanged:(UISlider *)slider {
-    self.value = @(slider.value);
+	if( self.sliderValueHandler != nil ) {
+		self.sliderValueHandler( self, slider.value );
+	}
+
+	if( self.continuousUpdateInterval <= 0 || ! slider.isTracking ) {
+		self.floatValue = slider.value;
+		return;
+	}
+
+	// Only the final value of a drag is written to storage
+	if( ! self.hasLiveValue ) {
+		self.numberOfCommitsSaved = 0;
+		self.lastLiveUpdateTime = 0;
+	}
+	else {
+		self.numberOfCommitsSaved += 1;
+	}
+
+	self.latestSliderValue = slider.value;
+	[self scheduleLiveUpdate];
+}
+
+- (void)sliderDidEndTracking:(UISlider *)slider {
+	if( ! self.hasLiveValue && ! self.isLiveUpdateScheduled ) {
+		return;
+	}
+
+	self.hasLiveValue = NO;
+
+	// If the slider ended up back where it started, observers still need to catch up from the live value
+	if( ! ( slider.value < (float)self.floatValue || slider.value > (float)self.floatValue ) ) {
+		[self _valueWillChange];
+		[self _valueDidChange];
+		return;
+	}
+
+	self.floatValue = slider.value;
+}
+
+- (void)scheduleLiveUpdate {
+	if( self.isLiveUpdateScheduled ) {
+		return;
+	}
+
+	NSTimeInterval delay = self.continuousUpdateInterval - ( CACurrentMediaTime() - self.lastLiveUpdateTime );
+	if( delay <= 0 ) {
+		[self sendLiveUpdate];
+		return;
+	}
+
+	// Make sure observers still see where the slider comes to rest, even if it's held there
+	self.liveUpdateScheduled = YES;
+	JSMStaticSliderPreference __weak *weakSelf = self;
+	dispatch_after(dispatch_time(DISPATCH_TIME_NOW, (int64_t)(delay * NSEC_PER_SEC)), dispatch_get_main_queue(), ^{
+		JSMStaticSliderPreference __strong *strongSelf = weakSelf;
+		strongSelf.liveUpdateScheduled = NO;
+		if( strongSelf.slider.isTracking ) {
+			[strongSelf sendLiveUpdate];
+		}
+	});
+}
+
+- (void)sendLiveUpdate {
+	self.lastLiveUpdateTime = CACurrentMediaTime();
+
+	[self _valueWillChange];
+	self.liveValue = self.latestSliderValue;
+	self.hasLiveValue = YES;
+	[self _valueDidChange];
 }
 
 @end
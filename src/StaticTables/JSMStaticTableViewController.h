@@ -42,6 +42,9 @@ NS_ASSUME_NONNULL_BEGIN
  * - `dataSource:sectionNeedsReload:atIndex:`
  * - `dataSource:rowNeedsReload:atIndexPath:`
  *
+ * Reloads requested through these methods are gathered together and performed in a single batch update at the end of
+ * the current turn of the run loop.
+ *
  * Of course, these implementations can be overridden if desired.
  */
 
@@ -69,6 +72,21 @@ NS_ASSUME_NONNULL_BEGIN
 
 @property (nonatomic, strong, readonly) JSMStaticDataSource *dataSource;
 
+///---------------------------------------------
+/// @name Reloading Content
+///---------------------------------------------
+
+/**
+ * Immediately reload any sections and rows that have requested a reload.
+ *
+ * Reloads requested through `dataSource:sectionNeedsReload:atIndex:` and `dataSource:rowNeedsReload:atIndexPath:`
+ * are gathered until the end of the current turn of the run loop and then performed as a single batch update. Rows are
+ * only reloaded once, and rows are skipped if their section is also being reloaded. This method performs the pending
+ * reloads without waiting, which may be useful before inspecting the table view's cells.
+ */
+
+- (void)performPendingReloads NS_SWIFT_NAME(performPendingReloads());
+
 ///---------------------------------------------
 /// @name Animating the Sections
 ///---------------------------------------------
@@ -163,6 +181,20 @@ NS_ASSUME_NONNULL_BEGIN
 
 - (void)removeSection:(__kindof JSMStaticSection *)section withRowAnimation:(UITableViewRowAnimation)animation NS_SWIFT_NAME(remove(_:with:));
 
+/**
+ * Replace the sections in the content structure, animating the differences.
+ *
+ * Sections and rows are matched by their `key`, or by identity if they don't have one, and the table view is updated
+ * with a single batch of insertions, deletions, moves and reloads. If a table view is not available, the data source is
+ * updated without animations, and if the table view is not visible, or doesn't reflect the current content, it is
+ * reloaded.
+ *
+ * @param sections The array of sections to display.
+ * @param animation The `UITableViewRowAnimation` you want to use for the update animation.
+ */
+
+- (void)setSections:(NSArray<__kindof JSMStaticSection *> *)sections withRowAnimation:(UITableViewRowAnimation)animation NS_SWIFT_NAME(setSections(_:with:));
+
 ///---------------------------------------------
 /// @name Animating the Rows
 ///---------------------------------------------
@@ -258,6 +290,20 @@ NS_ASSUME_NONNULL_BEGIN
 
 - (void)removeRow:(__kindof JSMStaticRow *)row withRowAnimation:(UITableViewRowAnimation)animation NS_SWIFT_NAME(remove(_:with:));
 
+/**
+ * Replace the rows in the given section, animating the differences.
+ *
+ * Rows are matched by their `key`, or by identity if they don't have one, and the table view is updated with a single
+ * batch of insertions, deletions, moves and reloads. If a table view is not available, the data source is updated
+ * without animations, and if the table view is not visible, or doesn't reflect the current content, it is reloaded.
+ *
+ * @param rows The array of rows to display within the section.
+ * @param section The section to update.
+ * @param animation The `UITableViewRowAnimation` you want to use for the update animation.
+ */
+
+- (void)setRows:(NSArray<__kindof JSMStaticRow *> *)rows forSection:(__kindof JSMStaticSection *)section withRowAnimation:(UITableViewRowAnimation)animation NS_SWIFT_NAME(setRows(_:for:with:));
+
 @end
 
 NS_ASSUME_NONNULL_END
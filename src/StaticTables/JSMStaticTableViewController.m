@@ -30,7 +30,29 @@
 
 @interface JSMStaticRow (JSMStaticTableViewController)
 
-- (void)prepareCell:(UITableViewCell *)cell;
+- (BOOL)getCachedHeight:(CGFloat *)height forWidth:(CGFloat)width;
+
+- (void)setCachedHeight:(CGFloat)height forWidth:(CGFloat)width;
+
+@end
+
+@interface JSMStaticDataSource (JSMStaticTableViewController)
+
+- (void)prepareCellIfNeeded:(UITableViewCell *)cell forRow:(JSMStaticRow *)row;
+
+- (void)invalidateConfigurationForCell:(UITableViewCell *)cell;
+
+- (void)willDisplayCell:(UITableViewCell *)cell forRow:(JSMStaticRow *)row;
+
+- (JSMStaticRow *)didEndDisplayingCell:(UITableViewCell *)cell;
+
+@end
+
+@interface JSMStaticPreference (JSMStaticTableViewController)
+
++ (BOOL)providesControlSize;
+
+- (void)recycleControl;
 
 @end
 
@@ -38,6 +60,18 @@
 
 @property (nonatomic) UITableViewStyle tableViewStyle;
 
+@property (nonatomic, strong) NSHashTable<JSMStaticSection *> *sectionsNeedingReload;
+
+@property (nonatomic, strong) NSHashTable<JSMStaticRow *> *rowsNeedingReload;
+
+@property (nonatomic, getter=isReloadScheduled) BOOL reloadScheduled;
+
+@property (nonatomic, copy) UIContentSizeCategory estimatedHeightsContentSizeCategory;
+
+@property (nonatomic) CGFloat estimatedRowHeight;
+
+@property (nonatomic) CGFloat estimatedSubtitleRowHeight;
+
 @end
 
 @implementation JSMStaticTableViewController
@@ -60,6 +94,7 @@
 - (void)loadView {
 	JSMTableView *tableView = [[JSMTableView alloc] initWithFrame:UIScreen.mainScreen.bounds style:self.tableViewStyle];
 	tableView.dataSource = self.dataSource;
+	tableView.prefetchDataSource = self.dataSource;
 	tableView.internalDelegate = self;
 	self.view = tableView;
 }
@@ -79,37 +114,194 @@
 #pragma mark - Static data source delegate
 
 - (void)dataSource:(JSMStaticDataSource *)dataSource sectionNeedsReload:(JSMStaticSection *)section atIndex:(NSUInteger)index {
-    [self.tableView beginUpdates];
-    [self.tableView reloadSections:[NSIndexSet indexSetWithIndex:index] withRowAnimation:UITableViewRowAnimationFade];
-    [self.tableView endUpdates];
+	[self.sectionsNeedingReload addObject:section];
+	[self scheduleReload];
 }
 
 - (void)dataSource:(JSMStaticDataSource *)dataSource rowNeedsReload:(JSMStaticRow *)row atIndexPath:(NSIndexPath *)indexPath {
-    [self.tableView beginUpdates];
-    [self.tableView reloadRowsAtIndexPaths:@[indexPath] withRowAnimation:UITableViewRowAnimationFade];
-    [self.tableView endUpdates];
+	[self.rowsNeedingReload addObject:row];
+	[self scheduleReload];
+}
+
+#pragma mark - Reloading Content
+
+- (NSHashTable<JSMStaticSection *> *)sectionsNeedingReload {
+	if( _sectionsNeedingReload == nil ) {
+		_sectionsNeedingReload = [NSHashTable hashTableWithOptions:NSPointerFunctionsWeakMemory|NSPointerFunctionsObjectPointerPersonality];
+	}
+	return _sectionsNeedingReload;
+}
+
+- (NSHashTable<JSMStaticRow *> *)rowsNeedingReload {
+	if( _rowsNeedingReload == nil ) {
+		_rowsNeedingReload = [NSHashTable hashTableWithOptions:NSPointerFunctionsWeakMemory|NSPointerFunctionsObjectPointerPersonality];
+	}
+	return _rowsNeedingReload;
+}
+
+- (void)scheduleReload {
+	if( self.isReloadScheduled ) {
+		return;
+	}
+
+	self.reloadScheduled = YES;
+
+	// Wait until the current turn of the run loop is done, so that everything changed along with this is reloaded together.
+	__weak typeof(self) weakSelf = self;
+	dispatch_async(dispatch_get_main_queue(), ^{
+		[weakSelf performPendingReloads];
+	});
+}
+
+- (void)performPendingReloads {
+	self.reloadScheduled = NO;
+
+	NSArray<JSMStaticSection *> *sections = self.sectionsNeedingReload.allObjects;
+	NSArray<JSMStaticRow *> *rows = self.rowsNeedingReload.allObjects;
+	[self.sectionsNeedingReload removeAllObjects];
+	[self.rowsNeedingReload removeAllObjects];
+
+	if( ( sections.count == 0 && rows.count == 0 ) || ! self.isViewLoaded ) {
+		return;
+	}
+
+	// If the table view is out of step with the data source, a batch of reloads would throw, so we reload everything.
+	if( ! [self tableViewReflectsDataSource] ) {
+		[self.tableView reloadData];
+		return;
+	}
+
+	NSMutableIndexSet *sectionIndexes = [NSMutableIndexSet indexSet];
+	for( JSMStaticSection *section in sections ) {
+		NSUInteger index = [self.dataSource indexForSection:section];
+		if( index != NSNotFound ) {
+			[sectionIndexes addIndex:index];
+		}
+	}
+
+	NSMutableArray<NSIndexPath *> *indexPaths = [NSMutableArray arrayWithCapacity:rows.count];
+	for( JSMStaticRow *row in rows ) {
+		NSIndexPath *indexPath = [self.dataSource indexPathForRow:row];
+		// Rows in a section that is being reloaded are reloaded along with it, and rows without a cell are configured when
+		// they come into view.
+		if( indexPath == nil || [sectionIndexes containsIndex:indexPath.section] || [self.tableView cellForRowAtIndexPath:indexPath] == nil ) {
+			continue;
+		}
+		[indexPaths addObject:indexPath];
+	}
+
+	if( sectionIndexes.count == 0 && indexPaths.count == 0 ) {
+		return;
+	}
+
+	[self.tableView beginUpdates];
+	[self.tableView reloadSections:sectionIndexes withRowAnimation:UITableViewRowAnimationFade];
+	[self.tableView reloadRowsAtIndexPaths:indexPaths withRowAnimation:UITableViewRowAnimationFade];
+	[self.tableView endUpdates];
+}
+
+- (BOOL)tableViewReflectsDataSource {
+	NSArray<JSMStaticSection *> *sections = self.dataSource.sections;
+	if( self.tableView.numberOfSections != (NSInteger)sections.count ) {
+		return NO;
+	}
+
+	for( NSUInteger index = 0; index < sections.count; index++ ) {
+		if( [self.tableView numberOfRowsInSection:index] != (NSInteger)sections[index].numberOfRows ) {
+			return NO;
+		}
+	}
+
+	return YES;
 }
 
 #pragma mark - Table view delegate
 
 - (CGFloat)tableView:(UITableView *)tableView estimatedHeightForRowAtIndexPath:(NSIndexPath *)indexPath {
-	return UITableViewAutomaticDimension;
+	JSMStaticRow *row = [self.dataSource rowAtIndexPath:indexPath];
+
+	// Use the actual height if we know it
+	CGFloat height;
+	if( [row getCachedHeight:&height forWidth:tableView.bounds.size.width] && height != UITableViewAutomaticDimension ) {
+		return height;
+	}
+
+	// Otherwise estimate it from the style and the current text size
+	if( ! [self.estimatedHeightsContentSizeCategory isEqualToString:tableView.traitCollection.preferredContentSizeCategory] ) {
+		UIFont *textFont = [UIFont preferredFontForTextStyle:UIFontTextStyleBody compatibleWithTraitCollection:tableView.traitCollection];
+		UIFont *detailTextFont = [UIFont preferredFontForTextStyle:UIFontTextStyleSubheadline compatibleWithTraitCollection:tableView.traitCollection];
+
+		self.estimatedRowHeight = MAX( 44.0, ceil( textFont.lineHeight ) + 22.0 );
+		self.estimatedSubtitleRowHeight = MAX( 44.0, ceil( textFont.lineHeight ) + ceil( detailTextFont.lineHeight ) + 22.0 );
+		self.estimatedHeightsContentSizeCategory = tableView.traitCollection.preferredContentSizeCategory;
+	}
+
+	return row.style == UITableViewCellStyleSubtitle ? self.estimatedSubtitleRowHeight : self.estimatedRowHeight;
 }
 
 - (CGFloat)tableView:(UITableView *)tableView heightForRowAtIndexPath:(NSIndexPath *)indexPath {
 	JSMStaticPreference *row = (JSMStaticPreference *)[self.dataSource rowAtIndexPath:indexPath];
 
-	if( [row isKindOfClass:[JSMStaticPreference class]] && row.control.translatesAutoresizingMaskIntoConstraints && row.control.frame.size.height > 44.0f ) {
-		return row.control.frame.size.height + 17;
+	// Heights are cached until the row changes
+	CGFloat width = tableView.bounds.size.width;
+	CGFloat height;
+	if( [row getCachedHeight:&height forWidth:width] ) {
+		return height;
 	}
 
-	return UITableViewAutomaticDimension;
+	height = UITableViewAutomaticDimension;
+	if( [row isKindOfClass:[JSMStaticPreference class]] ) {
+		// Don't load the control just to measure it, it'll be loaded when the row is displayed. Subclasses that don't
+		// provide a typical size can't be measured without it though.
+		UIControl *control = row.controlIfLoaded;
+		if( control == nil && ! row.fitControlToCell && ! [row.class providesControlSize] ) {
+			[row loadControlIfNeeded];
+			control = row.controlIfLoaded;
+		}
+
+		if( control != nil && control.translatesAutoresizingMaskIntoConstraints && control.frame.size.height > 44.0f ) {
+			height = control.frame.size.height + 17;
+		}
+		else if( control == nil && ! row.fitControlToCell && [row.class controlSize].height > 44.0f ) {
+			height = [row.class controlSize].height + 17;
+		}
+	}
+
+	[row setCachedHeight:height forWidth:width];
+
+	return height;
 }
 
 - (void)tableView:(UITableView *)tableView willDisplayCell:(UITableViewCell *)cell forRowAtIndexPath:(NSIndexPath *)indexPath {
-    // Workaround for alignment issues caused by cells having the "wrong" seperator inset size when the call to this method
-    // is initially made in `tableView:cellForRowAtIndexPath:`. This ensures alignment is always kept accurate.
-    [[self.dataSource rowAtIndexPath:indexPath] prepareCell:cell];
+    // Cells are configured in `tableView:cellForRowAtIndexPath:`, so this only catches rows that have changed since.
+    JSMStaticRow *row = [self.dataSource rowAtIndexPath:indexPath];
+    if( row == nil ) {
+        return;
+    }
+
+    [self.dataSource prepareCellIfNeeded:cell forRow:row];
+    [self.dataSource willDisplayCell:cell forRow:row];
+}
+
+- (void)tableView:(UITableView *)tableView didEndDisplayingCell:(UITableViewCell *)cell forRowAtIndexPath:(NSIndexPath *)indexPath {
+	// The index path may no longer point at the row the cell was displaying, so the data source looks it up by cell.
+	JSMStaticRow *row = [self.dataSource didEndDisplayingCell:cell];
+	if( ! [row isKindOfClass:[JSMStaticPreference class]] || ! [(JSMStaticPreference *)row recyclesControl] ) {
+		return;
+	}
+
+	JSMStaticPreference *preference = (JSMStaticPreference *)row;
+
+	// The preference may already be displayed by another cell, in which case it still needs the control.
+	UIControl *control = preference.controlIfLoaded;
+	if( control != nil && [control isDescendantOfView:cell] ) {
+		if( cell.accessoryView == control ) {
+			cell.accessoryView = nil;
+		}
+		[preference recycleControl];
+		// The cell may be displayed again without being dequeued, and will need the control back.
+		[self.dataSource invalidateConfigurationForCell:cell];
+	}
 }
 
 - (UITableViewCellEditingStyle)tableView:(UITableView *)tableView editingStyleForRowAtIndexPath:(NSIndexPath *)indexPath {
@@ -153,6 +345,11 @@
     [self.dataSource removeSection:section withRowAnimation:animation];
 }
 
+- (void)setSections:(NSArray<JSMStaticSection *> *)sections withRowAnimation:(UITableViewRowAnimation)animation {
+    [self validateDataSource];
+    [self.dataSource setSections:sections withRowAnimation:animation];
+}
+
 #pragma mark - Animating the Rows
 
 - (JSMStaticRow *)createRowAtIndexPath:(NSIndexPath *)indexPath withRowAnimation:(UITableViewRowAnimation)animation {
@@ -190,6 +387,11 @@
     [self.dataSource removeRow:row withRowAnimation:animation];
 }
 
+- (void)setRows:(NSArray<JSMStaticRow *> *)rows forSection:(JSMStaticSection *)section withRowAnimation:(UITableViewRowAnimation)animation {
+    [self validateDataSource];
+    [self.dataSource setRows:rows forSection:section withRowAnimation:animation];
+}
+
 #pragma mark - Utilities
 
 // Throw an exception if we don't have the right data source
@@ -69,6 +69,14 @@ NS_ASSUME_NONNULL_BEGIN
 
 @property (nonatomic, weak, readonly) UITextField *textField;
 
+/**
+ * The number of seconds after the user stops typing before the text is saved as the value. Defaults to 0.5 seconds.
+ *
+ * The text is always saved immediately when editing ends.
+ */
+
+@property (nonatomic) NSTimeInterval editingDelay;
+
 @end
 
 NS_ASSUME_NONNULL_END
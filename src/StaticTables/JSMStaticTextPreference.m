@@ -26,8 +26,6 @@
 
 @interface JSMStaticTextPreference ()
 
-@property (nonatomic, strong) NSTimer *timer;
-
 @property (nonatomic, strong) UITapGestureRecognizer *gestureRecognizer;
 
 @end
@@ -40,16 +38,39 @@
 
 @end
 
+@interface JSMStaticPreference (JSMStaticTextPreference)
+
+- (void)installControlInCell:(UITableViewCell *)cell withConstraints:(NSArray<NSLayoutConstraint *> *(^)(UIControl *control, UITableViewCell *cell))constraintsBlock;
+
+@end
+
 @implementation JSMStaticTextPreference
 
 @dynamic value;
 @dynamic defaultValue;
 
+#pragma mark - Creating Preferences
+
+- (instancetype)initWithKey:(id)key andUserDefaultsKey:(NSString *)userDefaultsKey {
+	if( ( self = [super initWithKey:key andUserDefaultsKey:userDefaultsKey] ) ) {
+		_editingDelay = 0.5;
+	}
+	return self;
+}
+
 #pragma mark - User Interface
 
 - (void)loadControl {
 	UITextField *textField = [[UITextField alloc] initWithFrame:CGRectMake( 0, 0, 180, 44 )];
 	textField.autoresizingMask = UIViewAutoresizingFlexibleWidth;
+
+	super.control = (UIControl *)textField;
+}
+
+- (void)controlDidLoad {
+	[super controlDidLoad];
+
+	UITextField *textField = self.textField;
 	textField.placeholder = self.text;
 	textField.text = self.value;
 	[textField addTarget:self action:@selector(textFieldChanged:) forControlEvents:UIControlEventEditingChanged];
@@ -59,14 +80,27 @@
 	gestureRecognizer.numberOfTapsRequired = 1;
 	gestureRecognizer.numberOfTouchesRequired = 1;
 	_gestureRecognizer = gestureRecognizer;
+}
 
-	super.control = (UIControl *)textField;
+- (void)controlWillBeRecycled {
+	[super controlWillBeRecycled];
+
+	// Save anything that's waiting to be committed
+	[self commitPendingValue];
+
+	// The gesture recognizer is tied to this particular text field
+	[_gestureRecognizer.view removeGestureRecognizer:_gestureRecognizer];
+	_gestureRecognizer = nil;
 }
 
 - (UITextField *)textField {
     return (UITextField *)self.control;
 }
 
++ (CGSize)controlSize {
+	return CGSizeMake( 180, 44 );
+}
+
 #pragma mark - Configuring the cell
 
 - (void)prepareCell:(UITableViewCell *)cell {
@@ -79,30 +113,24 @@
             self.selectionStyle = UITableViewCellSelectionStyleNone;
         }
         if( ! self.fitControlToCell ) {
-			if( ! [self.control.superview isEqual:cell.contentView] ) {
-				[cell.contentView addSubview:self.control];
-			}
-
-			self.control.translatesAutoresizingMaskIntoConstraints = NO;
-			[cell.contentView addConstraints:@[
-											  [NSLayoutConstraint constraintWithItem:self.control attribute:NSLayoutAttributeTop relatedBy:NSLayoutRelationEqual toItem:cell.contentView attribute:NSLayoutAttributeTopMargin multiplier:1 constant:0],
-											  [NSLayoutConstraint constraintWithItem:self.control attribute:NSLayoutAttributeBottom relatedBy:NSLayoutRelationEqual toItem:cell.contentView attribute:NSLayoutAttributeBottomMargin multiplier:1 constant:0],
-											  [NSLayoutConstraint constraintWithItem:self.control attribute:NSLayoutAttributeLeft relatedBy:NSLayoutRelationLessThanOrEqual toItem:cell.textLabel attribute:NSLayoutAttributeRightMargin multiplier:1 constant:30],
-											  [NSLayoutConstraint constraintWithItem:self.control attribute:NSLayoutAttributeRight relatedBy:NSLayoutRelationEqual toItem:cell.contentView attribute:NSLayoutAttributeRightMargin multiplier:1 constant:0]
-											  ]];
+			[self installControlInCell:cell withConstraints:^NSArray<NSLayoutConstraint *> *(UIControl *control, UITableViewCell *cell) {
+				return @[
+						 [NSLayoutConstraint constraintWithItem:control attribute:NSLayoutAttributeTop relatedBy:NSLayoutRelationEqual toItem:cell.contentView attribute:NSLayoutAttributeTopMargin multiplier:1 constant:0],
+						 [NSLayoutConstraint constraintWithItem:control attribute:NSLayoutAttributeBottom relatedBy:NSLayoutRelationEqual toItem:cell.contentView attribute:NSLayoutAttributeBottomMargin multiplier:1 constant:0],
+						 [NSLayoutConstraint constraintWithItem:control attribute:NSLayoutAttributeLeft relatedBy:NSLayoutRelationLessThanOrEqual toItem:cell.textLabel attribute:NSLayoutAttributeRightMargin multiplier:1 constant:30],
+						 [NSLayoutConstraint constraintWithItem:control attribute:NSLayoutAttributeRight relatedBy:NSLayoutRelationEqual toItem:cell.contentView attribute:NSLayoutAttributeRightMargin multiplier:1 constant:0]
+						 ];
+			}];
         }
         else if( self.fitControlToCell ) {
-			if( ! [self.control.superview isEqual:cell.contentView] ) {
-				[cell.contentView addSubview:self.control];
-			}
-
-			self.control.translatesAutoresizingMaskIntoConstraints = NO;
-			[cell.contentView addConstraints:@[
-											  [NSLayoutConstraint constraintWithItem:self.control attribute:NSLayoutAttributeTop relatedBy:NSLayoutRelationEqual toItem:cell.contentView attribute:NSLayoutAttributeTopMargin multiplier:1 constant:0],
-											  [NSLayoutConstraint constraintWithItem:self.control attribute:NSLayoutAttributeBottom relatedBy:NSLayoutRelationEqual toItem:cell.contentView attribute:NSLayoutAttributeBottomMargin multiplier:1 constant:0],
-											  [NSLayoutConstraint constraintWithItem:self.control attribute:NSLayoutAttributeLeft relatedBy:NSLayoutRelationEqual toItem:cell.contentView attribute:NSLayoutAttributeLeftMargin multiplier:1 constant:0],
-											  [NSLayoutConstraint constraintWithItem:self.control attribute:NSLayoutAttributeRight relatedBy:NSLayoutRelationEqual toItem:cell.contentView attribute:NSLayoutAttributeRightMargin multiplier:1 constant:0]
-											  ]];
+			[self installControlInCell:cell withConstraints:^NSArray<NSLayoutConstraint *> *(UIControl *control, UITableViewCell *cell) {
+				return @[
+						 [NSLayoutConstraint constraintWithItem:control attribute:NSLayoutAttributeTop relatedBy:NSLayoutRelationEqual toItem:cell.contentView attribute:NSLayoutAttributeTopMargin multiplier:1 constant:0],
+						 [NSLayoutConstraint constraintWithItem:control attribute:NSLayoutAttributeBottom relatedBy:NSLayoutRelationEqual toItem:cell.contentView attribute:NSLayoutAttributeBottomMargin multiplier:1 constant:0],
+						 [NSLayoutConstraint constraintWithItem:control attribute:NSLayoutAttributeLeft relatedBy:NSLayoutRelationEqual toItem:cell.contentView attribute:NSLayoutAttributeLeftMargin multiplier:1 constant:0],
+						 [NSLayoutConstraint constraintWithItem:control attribute:NSLayoutAttributeRight relatedBy:NSLayoutRelationEqual toItem:cell.contentView attribute:NSLayoutAttributeRightMargin multiplier:1 constant:0]
+						 ];
+			}];
         }
     }
 
@@ -119,22 +147,14 @@
 
 #pragma mark - Event Handling
 
-// We use a timer to try and update the value only once the user has finished typing.
+// We try and update the value only once the user has finished typing.
 - (void)textFieldChanged:(UITextField *)textField {
-    if( self.timer != nil && self.timer.isValid ) {
-        [self.timer invalidate];
-        self.timer = nil;
-    }
-    self.timer = [NSTimer timerWithTimeInterval:0.5 target:self selector:@selector(timerFired:) userInfo:nil repeats:NO];
-    [[NSRunLoop currentRunLoop] addTimer:self.timer forMode:NSDefaultRunLoopMode];
-}
-
-- (void)timerFired:(NSTimer *)timer {
-    self.value = self.textField.text;
+    [self setValue:textField.text afterDelay:self.editingDelay];
 }
 
 - (void)updatePreferenceValue:(UITextField *)textField {
-    self.value = textField.text;
+    [self setValue:textField.text afterDelay:0];
+    [self commitPendingValue];
 }
 
 @end
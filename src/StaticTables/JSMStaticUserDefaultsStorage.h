@@ -0,0 +1,73 @@
+//
+// Copyright © 2019 Daniel Farrelly
+//
+// Redistribution and use in source and binary forms, with or without modification,
+// are permitted provided that the following conditions are met:
+//
+// *	Redistributions of source code must retain the above copyright notice, this list
+//		of conditions and the following disclaimer.
+// *	Redistributions in binary form must reproduce the above copyright notice, this
+//		list of conditions and the following disclaimer in the documentation and/or
+//		other materials provided with the distribution.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+// ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+// WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+// IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+// INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+// BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+// DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+// LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE
+// OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+// ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//
+
+@import Foundation;
+#import "JSMStaticPreferenceStorage.h"
+
+NS_ASSUME_NONNULL_BEGIN
+
+/**
+ * A `JSMStaticUserDefaultsStorage` stores preference values in an instance of `NSUserDefaults`, such as the standard
+ * user defaults, or a suite shared by an app group.
+ */
+
+@interface JSMStaticUserDefaultsStorage : NSObject <JSMStaticPreferenceStorage>
+
+/**
+ * The storage backed by the standard user defaults, which is used by preferences unless another is provided.
+ *
+ * @return The shared instance of `JSMStaticUserDefaultsStorage`.
+ */
+
++ (instancetype)standardStorage;
+
+/**
+ * Initialises a new instance of `JSMStaticUserDefaultsStorage` backed by the given user defaults.
+ *
+ * @param userDefaults The user defaults to store values in.
+ * @return A new instance of `JSMStaticUserDefaultsStorage`.
+ */
+
+- (instancetype)initWithUserDefaults:(NSUserDefaults *)userDefaults NS_DESIGNATED_INITIALIZER;
+
+/**
+ * Initialises a new instance of `JSMStaticUserDefaultsStorage` backed by the user defaults with the given suite name.
+ *
+ * @param suiteName The name of the user defaults suite, such as an app group identifier.
+ * @return A new instance of `JSMStaticUserDefaultsStorage`.
+ */
+
+- (instancetype)initWithSuiteName:(NSString *)suiteName;
+
+- (instancetype)init NS_UNAVAILABLE;
+
+/**
+ * The user defaults the reciever stores values in.
+ */
+
+@property (nonatomic, strong, readonly) NSUserDefaults *userDefaults;
+
+@end
+
+NS_ASSUME_NONNULL_END
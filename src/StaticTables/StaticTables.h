@@ -29,12 +29,21 @@
 #import "JSMStaticDataSource+Convenience.h"
 #import "JSMStaticSection.h"
 #import "JSMStaticRow.h"
+#import "JSMStaticDiff.h"
+#import "JSMStaticImageCache.h"
 
 #import "UITableView+StaticTables.h"
 
 #import "JSMStaticPreference.h"
+#import "JSMStaticPreferenceStorage.h"
+#import "JSMStaticMemoryStorage.h"
+#import "JSMStaticUserDefaultsStorage.h"
+#import "JSMStaticFileStorage.h"
+#import "JSMStaticPreferenceCache.h"
 #import "JSMStaticTextPreference.h"
 #import "JSMStaticBooleanPreference.h"
 #import "JSMStaticSelectPreference.h"
+#import "JSMStaticSelectOption.h"
+#import "JSMStaticFileOptionSource.h"
 #import "JSMStaticSelectPreferenceViewController.h"
 #import "JSMStaticSliderPreference.h"
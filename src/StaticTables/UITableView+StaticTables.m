@@ -99,6 +99,11 @@
     [(JSMStaticDataSource *)self.dataSource removeSection:section withRowAnimation:animation];
 }
 
+- (void)setSections:(NSArray<JSMStaticSection *> *)sections withRowAnimation:(UITableViewRowAnimation)animation {
+    [self validateDataSource];
+    [(JSMStaticDataSource *)self.dataSource setSections:sections withRowAnimation:animation];
+}
+
 #pragma mark - Animating the Rows
 
 - (JSMStaticRow *)createRowAtIndexPath:(NSIndexPath *)indexPath withRowAnimation:(UITableViewRowAnimation)animation {
@@ -146,6 +151,11 @@
     [(JSMStaticDataSource *)self.dataSource removeRow:row withRowAnimation:animation];
 }
 
+- (void)setRows:(NSArray<JSMStaticRow *> *)rows forSection:(JSMStaticSection *)section withRowAnimation:(UITableViewRowAnimation)animation {
+    [self validateDataSource];
+    [(JSMStaticDataSource *)self.dataSource setRows:rows forSection:section withRowAnimation:animation];
+}
+
 #pragma mark - Utilities
 
 // Throw an exception if we don't have the right data source
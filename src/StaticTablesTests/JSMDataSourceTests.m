@@ -25,7 +25,25 @@
 @import XCTest;
 @import StaticTables;
 
-@interface JSMDataSourceTests : XCTestCase
+@interface JSMDataSourceTests : XCTestCase <JSMStaticDataSourceDelegate, JSMStaticSectionDelegate>
+
+@property (nonatomic) NSUInteger sectionsDidChangeCount;
+
+@property (nonatomic) NSUInteger rowsDidChangeCount;
+
+@end
+
+@interface JSMStaticDataSource (JSMDataSourceTests)
+
+- (void)prepareCellIfNeeded:(UITableViewCell *)cell forRow:(JSMStaticRow *)row;
+
+- (void)willDisplayCell:(UITableViewCell *)cell forRow:(JSMStaticRow *)row;
+
+- (JSMStaticRow *)didEndDisplayingCell:(UITableViewCell *)cell;
+
+@end
+
+@interface JSMDataSourceTestsTallPreference : JSMStaticPreference
 
 @end
 
@@ -33,6 +51,8 @@
 
 - (void)setUp {
     [super setUp];
+    self.sectionsDidChangeCount = 0;
+    self.rowsDidChangeCount = 0;
 }
 
 - (void)tearDown {
@@ -71,6 +91,18 @@
     return [JSMStaticRow rowWithKey:@"simpleRow"];
 }
 
+#pragma mark - Delegates
+
+- (NSArray *)dataSource:(JSMStaticDataSource *)dataSource sectionsDidChange:(NSArray *)sections {
+    self.sectionsDidChangeCount++;
+    return sections;
+}
+
+- (NSArray *)section:(JSMStaticSection *)section rowsDidChange:(NSArray *)rows {
+    self.rowsDidChangeCount++;
+    return rows;
+}
+
 #pragma mark - Tests
 
 - (void)testNewDataSource {
@@ -147,4 +179,208 @@
     XCTAssertEqualObjects( [dataSource rowWithKey:key], row, @"Row is not retrievable with supplied key." );
 }
 
+- (void)testRowWithKeyAfterMutation {
+    JSMStaticDataSource *dataSource = [self simpleDataSource];
+    JSMStaticSection *sectionA = [dataSource sectionWithKey:@"a"];
+    JSMStaticSection *sectionB = [dataSource sectionWithKey:@"b"];
+
+    JSMStaticRow *row = [dataSource rowWithKey:@"one"];
+    XCTAssertEqual( row.section, sectionA, @"Row with a shared key should be resolved from the first section containing it." );
+
+    [sectionA removeRow:row];
+    XCTAssertEqual( [dataSource rowWithKey:@"one"].section, sectionB, @"Row with a shared key should be resolved from the next section after removal." );
+    XCTAssertNil( [sectionA rowWithKey:@"one"], @"Removed row should no longer be retrievable from its section." );
+
+    [sectionA insertRow:row atIndex:0];
+    XCTAssertEqual( [dataSource rowWithKey:@"one"], row, @"Reinserted row should be resolved again from the first section." );
+
+    [dataSource removeSection:sectionA];
+    XCTAssertNil( [dataSource sectionWithKey:@"a"], @"Removed section should no longer be retrievable by key." );
+    XCTAssertEqual( [dataSource rowWithKey:@"one"].section, sectionB, @"Rows from a removed section should no longer be retrievable by key." );
+}
+
+- (void)testIdentityComparison {
+    JSMStaticDataSource *dataSource = [self simpleDataSource];
+    dataSource.usesIdentityComparison = YES;
+
+    JSMStaticSection *section = [dataSource sectionWithKey:@"simpleSection"];
+    JSMStaticRow *row = [section rowWithKey:@"simpleRow"];
+
+    XCTAssertTrue( [dataSource containsSection:section], @"Data source should contain the section instance it was given." );
+    XCTAssertFalse( [dataSource containsSection:[self simpleSection]], @"Data source should not contain an equal section instance when comparing by identity." );
+    XCTAssertEqual( [dataSource indexForSection:[self simpleSection]], (NSUInteger)NSNotFound, @"Equal section instance should not be found when comparing by identity." );
+
+    XCTAssertTrue( [section containsRow:row], @"Section should contain the row instance it was given." );
+    XCTAssertFalse( [section containsRow:[self simpleRow]], @"Section should not contain an equal row instance when comparing by identity." );
+
+    [section removeRow:[self simpleRow]];
+    XCTAssertEqual( row.section, section, @"Removing an equal row instance should not remove the contained row when comparing by identity." );
+}
+
+- (void)testPerformBatchMutations {
+    JSMStaticDataSource *dataSource = [self simpleDataSource];
+    dataSource.delegate = self;
+
+    JSMStaticSection *section = [dataSource sectionWithKey:@"a"];
+    section.delegate = self;
+
+    [dataSource performBatchMutations:^{
+        for( NSUInteger i = 0; i < 100; i++ ) {
+            [section createRow];
+        }
+
+        [dataSource performBatchMutations:^{
+            [dataSource createSection];
+            [dataSource createSection];
+        }];
+
+        XCTAssertTrue( dataSource.isPerformingBatchMutations, @"Data source should still be performing batch mutations after a nested batch." );
+        XCTAssertEqual( self.rowsDidChangeCount, (NSUInteger)0, @"Section delegate should not be notified during a batch." );
+        XCTAssertEqual( self.sectionsDidChangeCount, (NSUInteger)0, @"Data source delegate should not be notified during a batch." );
+    }];
+
+    XCTAssertFalse( dataSource.isPerformingBatchMutations, @"Data source should not be performing batch mutations once the batch is complete." );
+    XCTAssertEqual( self.rowsDidChangeCount, (NSUInteger)1, @"Section delegate should be notified once after the batch." );
+    XCTAssertEqual( self.sectionsDidChangeCount, (NSUInteger)1, @"Data source delegate should be notified once after the batch." );
+    XCTAssertEqual( section.numberOfRows, (NSUInteger)104, @"Rows added during the batch should be contained in the section." );
+}
+
+
+- (void)testDiffMatchesRowsByKey {
+    NSArray *originalRows = @[ [JSMStaticRow rowWithKey:@"a"], [JSMStaticRow rowWithKey:@"b"], [JSMStaticRow rowWithKey:@"c"] ];
+    NSArray *updatedRows = @[ [JSMStaticRow rowWithKey:@"c"], [JSMStaticRow rowWithKey:@"d"] ];
+    [originalRows[2] setText:@"Original"];
+    [updatedRows[0] setText:@"Updated"];
+
+    JSMStaticDiff *diff = [JSMStaticDiff diffFromObjects:originalRows toObjects:updatedRows];
+
+    XCTAssertTrue( diff.hasChanges, @"Diff should report changes." );
+    XCTAssertEqualObjects( diff.deletedIndexes, [NSIndexSet indexSetWithIndexesInRange:NSMakeRange(0, 2)], @"Rows without a matching key should be deleted." );
+    XCTAssertEqualObjects( diff.insertedIndexes, [NSIndexSet indexSetWithIndex:1], @"Rows with a new key should be inserted." );
+    XCTAssertEqualObjects( diff.reloadedIndexes, [NSIndexSet indexSetWithIndex:2], @"Replaced rows with a matching key and different content should be reloaded." );
+    XCTAssertEqual( diff.movedIndexes.count, (NSUInteger)0, @"Rows that keep their relative order should not be moved." );
+    XCTAssertEqual( [diff updatedIndexForIndex:2], (NSUInteger)0, @"Matched rows should map to their updated index." );
+    XCTAssertEqual( [diff updatedIndexForIndex:0], (NSUInteger)NSNotFound, @"Deleted rows should not map to an updated index." );
+}
+
+
+- (void)testDiffIgnoresReplacedRowsWithSameContent {
+    NSMutableArray *originalRows = [NSMutableArray array];
+    NSMutableArray *updatedRows = [NSMutableArray array];
+    for( NSString *key in @[ @"a", @"b", @"c", @"d" ] ) {
+        JSMStaticRow *originalRow = [JSMStaticRow rowWithKey:key];
+        originalRow.text = key.uppercaseString;
+        originalRow.accessoryType = UITableViewCellAccessoryDisclosureIndicator;
+        [originalRows addObject:originalRow];
+
+        JSMStaticRow *updatedRow = [JSMStaticRow rowWithKey:key];
+        updatedRow.text = key.uppercaseString;
+        updatedRow.accessoryType = UITableViewCellAccessoryDisclosureIndicator;
+        [updatedRows insertObject:updatedRow atIndex:0];
+    }
+
+    JSMStaticDiff *diff = [JSMStaticDiff diffFromObjects:originalRows toObjects:updatedRows];
+
+    XCTAssertEqual( diff.reloadedIndexes.count, (NSUInteger)0, @"Replaced rows with the same content should not be reloaded." );
+    XCTAssertEqual( diff.deletedIndexes.count, (NSUInteger)0, @"Replaced rows with the same content should not be deleted." );
+    XCTAssertEqual( diff.insertedIndexes.count, (NSUInteger)0, @"Replaced rows with the same content should not be inserted." );
+    XCTAssertEqual( diff.movedIndexes.count, (NSUInteger)3, @"Replaced rows with the same content should only be moved." );
+}
+
+
+- (void)testReplacedVisibleRowsKeepTheirCell {
+    JSMStaticTableViewController *viewController = [[JSMStaticTableViewController alloc] initWithStyle:UITableViewStylePlain];
+    UIWindow *window = [[UIWindow alloc] initWithFrame:CGRectMake(0, 0, 320, 480)];
+    window.rootViewController = viewController;
+    window.hidden = NO;
+
+    JSMStaticDataSource *dataSource = viewController.dataSource;
+    JSMStaticSection *section = [dataSource createSection];
+    JSMStaticRow *row = [JSMStaticRow rowWithKey:@"row"];
+    row.text = @"Text";
+    [section addRow:row];
+    [viewController.tableView reloadData];
+    [viewController.tableView layoutIfNeeded];
+
+    UITableViewCell *cell = row.currentCell;
+    XCTAssertNotNil( cell, @"Row should be displayed in a cell." );
+
+    JSMStaticRow *replacementRow = [JSMStaticRow rowWithKey:@"row"];
+    replacementRow.text = @"Text";
+    [dataSource setRows:@[ replacementRow ] forSection:section withRowAnimation:UITableViewRowAnimationNone];
+
+    XCTAssertEqual( replacementRow.currentCell, cell, @"Replacement rows with the same content should take over the cell." );
+    XCTAssertNil( row.currentCell, @"Replaced rows should no longer have a cell." );
+
+    replacementRow.text = @"Changed";
+    XCTAssertEqualObjects( cell.textLabel.text, @"Changed", @"Changes to the replacement row should be shown in the cell." );
+
+    window.hidden = YES;
+}
+
+- (void)testHeightOfPreferenceWithoutControlSize {
+    JSMStaticTableViewController *viewController = [[JSMStaticTableViewController alloc] initWithStyle:UITableViewStylePlain];
+    JSMDataSourceTestsTallPreference *preference = [JSMDataSourceTestsTallPreference preferenceWithKey:@"JSMDataSourceTestsTallPreference"];
+    [[viewController.dataSource createSection] addRow:preference];
+
+    CGFloat height = [viewController tableView:viewController.tableView heightForRowAtIndexPath:[NSIndexPath indexPathForRow:0 inSection:0]];
+    XCTAssertNotNil( preference.controlIfLoaded, @"Preferences without a control size should load their control to be measured." );
+    XCTAssertEqualWithAccuracy( height, 117.0, 0.001, @"Row height should fit the loaded control." );
+}
+
+- (void)testReuseIdentifierForCellClass {
+    NSString *identifier = [JSMStaticDataSource reuseIdentifierForCellClass:[UITableViewCell class] style:UITableViewCellStyleSubtitle];
+
+    XCTAssertEqualObjects( identifier, @"JSMStaticDataSourceSubtitleReuseIdentifier.UITableViewCell", @"Reuse identifier should include the style and class." );
+    XCTAssertTrue( identifier == [JSMStaticDataSource reuseIdentifierForCellClass:[UITableViewCell class] style:UITableViewCellStyleSubtitle], @"Reuse identifiers should be cached." );
+    XCTAssertEqualObjects( [JSMStaticDataSource reuseIdentifierForCellClass:[UITableViewCell class] style:(UITableViewCellStyle)99], @"JSMStaticDataSourceValue1ReuseIdentifier.UITableViewCell", @"Unknown styles should fall back to the value 1 style." );
+}
+
+- (void)testCellConfiguredOncePerChange {
+    JSMStaticDataSource *dataSource = [JSMStaticDataSource new];
+    JSMStaticRow *row = [[dataSource createSection] createRow];
+    UITableView *tableView = [[UITableView alloc] initWithFrame:CGRectMake(0, 0, 320, 480) style:UITableViewStylePlain];
+
+    __block NSUInteger configurations = 0;
+    [row configurationForCell:^(JSMStaticRow *row, UITableViewCell *cell) {
+        configurations++;
+    }];
+
+    UITableViewCell *cell = [dataSource tableView:tableView cellForRowAtIndexPath:[NSIndexPath indexPathForRow:0 inSection:0]];
+    XCTAssertEqual( configurations, (NSUInteger)1, @"Cell should be configured when it is created." );
+
+    [dataSource prepareCellIfNeeded:cell forRow:row];
+    XCTAssertEqual( configurations, (NSUInteger)1, @"Cell should not be configured again for an unchanged row." );
+
+    [row setNeedsReload];
+    [dataSource prepareCellIfNeeded:cell forRow:row];
+    XCTAssertEqual( configurations, (NSUInteger)2, @"Cell should be configured again once the row has changed." );
+}
+
+- (void)testCurrentCellTracksDisplayedCells {
+    JSMStaticDataSource *dataSource = [JSMStaticDataSource new];
+    JSMStaticRow *row = [[dataSource createSection] createRow];
+    UITableViewCell *cell = [[UITableViewCell alloc] initWithStyle:UITableViewCellStyleDefault reuseIdentifier:nil];
+
+    [dataSource willDisplayCell:cell forRow:row];
+    XCTAssertEqual( row.currentCell, cell, @"Row should return the cell it is displayed in." );
+
+    row.text = @"Text";
+    XCTAssertEqualObjects( cell.textLabel.text, @"Text", @"Visible rows should update their cell in place." );
+
+    XCTAssertEqual( [dataSource didEndDisplayingCell:cell], row, @"Data source should return the row the cell was displaying." );
+    XCTAssertNil( row.currentCell, @"Row should not return a cell once it is no longer displayed." );
+
+    row.text = @"Other";
+    XCTAssertTrue( row.needsReload, @"Rows that aren't visible should be marked for reload." );
+}
+
+@end
+
+@implementation JSMDataSourceTestsTallPreference
+
+- (void)loadControl {
+    self.control = [[UIControl alloc] initWithFrame:CGRectMake(0, 0, 100, 100)];
+}
+
 @end
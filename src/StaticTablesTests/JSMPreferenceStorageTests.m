@@ -0,0 +1,274 @@
+//
+// Copyright © 2019 Daniel Farrelly
+//
+// Redistribution and use in source and binary forms, with or without modification,
+// are permitted provided that the following conditions are met:
+//
+// *	Redistributions of source code must retain the above copyright notice, this list
+//		of conditions and the following disclaimer.
+// *	Redistributions in binary form must reproduce the above copyright notice, this
+//		list of conditions and the following disclaimer in the documentation and/or
+//		other materials provided with the distribution.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+// ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+// WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+// IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+// INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+// BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+// DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+// LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE
+// OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+// ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//
+
+@import XCTest;
+@import StaticTables;
+
+@interface JSMPreferenceStorageTests : XCTestCase <JSMStaticPreferenceObserver>
+
+@property (nonatomic) NSUInteger numberOfBoolValueChanges;
+
+@property (nonatomic) BOOL lastBoolValue;
+
+@end
+
+@interface JSMStaticSliderPreference (JSMPreferenceStorageTests)
+
+- (void)sliderChanged:(UISlider *)slider;
+
+- (void)sliderDidEndTracking:(UISlider *)slider;
+
+@end
+
+@interface JSMPreferenceStorageTestsSlider : UISlider
+
+@property (nonatomic, getter=isTracking) BOOL tracking;
+
+@end
+
+@interface JSMPreferenceStorageTestsSliderPreference : JSMStaticSliderPreference
+
+@end
+
+@interface JSMPreferenceStorageTestsStorage : JSMStaticMemoryStorage
+
+@property (nonatomic) NSUInteger numberOfWrites;
+
+@end
+
+@implementation JSMPreferenceStorageTests
+
+- (void)test_memoryStorage {
+	JSMStaticMemoryStorage *storage = [JSMStaticMemoryStorage new];
+	[storage setObjects:@{ @"one": @1, @"two": @2 }];
+	[storage setObjects:@{ @"two": [NSNull null] }];
+
+	NSDictionary *objects = [storage objectsForKeys:@[ @"one", @"two", @"three" ]];
+	XCTAssertEqualObjects( objects, @{ @"one": @1 }, @"Storage should only return keys that have values." );
+}
+
+- (void)test_fileStorage {
+	NSURL *fileURL = [NSURL fileURLWithPath:[NSTemporaryDirectory() stringByAppendingPathComponent:NSUUID.UUID.UUIDString]];
+
+	JSMStaticFileStorage *storage = [[JSMStaticFileStorage alloc] initWithFileURL:fileURL];
+	[storage setObjects:@{ @"one": @1, @"two": @"two" }];
+	[storage flush];
+
+	JSMStaticFileStorage *otherStorage = [[JSMStaticFileStorage alloc] initWithFileURL:fileURL];
+	NSDictionary *objects = [otherStorage objectsForKeys:@[ @"one", @"two" ]];
+	XCTAssertEqualObjects( objects, (@{ @"one": @1, @"two": @"two" }), @"Flushed values should be read from the file." );
+
+	[[NSFileManager defaultManager] removeItemAtURL:fileURL error:nil];
+}
+
+- (void)test_fileStorageWriteError {
+	NSString *directory = [NSTemporaryDirectory() stringByAppendingPathComponent:NSUUID.UUID.UUIDString];
+	NSURL *fileURL = [NSURL fileURLWithPath:[directory stringByAppendingPathComponent:@"values.plist"]];
+
+	JSMStaticFileStorage *storage = [[JSMStaticFileStorage alloc] initWithFileURL:fileURL];
+	[storage setObjects:@{ @"one": @1 }];
+
+	NSError *error = nil;
+	XCTAssertFalse( [storage writeToFileReturningError:&error], @"Writing to a missing directory should fail." );
+	XCTAssertNotNil( error, @"Failed writes should report an error." );
+	XCTAssertEqualObjects( storage.lastError, error, @"Failed writes should be recorded as the last error." );
+
+	[[NSFileManager defaultManager] createDirectoryAtPath:directory withIntermediateDirectories:YES attributes:nil error:nil];
+	[storage flush];
+	XCTAssertNil( storage.lastError, @"Changes that failed to save should be written the next time the storage is flushed." );
+	XCTAssertEqualObjects( [[[JSMStaticFileStorage alloc] initWithFileURL:fileURL] objectsForKeys:@[ @"one" ]], @{ @"one": @1 }, @"Changes that failed to save should be kept." );
+
+	[[NSFileManager defaultManager] removeItemAtPath:directory error:nil];
+}
+
+- (void)test_cache {
+	JSMStaticMemoryStorage *storage = [JSMStaticMemoryStorage new];
+	JSMStaticPreferenceCache *cache = [JSMStaticPreferenceCache cacheForStorage:storage];
+
+	XCTAssertEqual( cache, [JSMStaticPreferenceCache cacheForStorage:storage], @"Each storage should have a single cache." );
+
+	[cache setObject:@"value" forKey:@"key"];
+	XCTAssertEqualObjects( [cache objectForKey:@"key"], @"value", @"Cache should return unsaved values." );
+	XCTAssertTrue( cache.hasPendingChanges, @"Cache should have pending changes." );
+	XCTAssertNil( [storage objectsForKeys:@[ @"key" ]][@"key"], @"Storage should not be written to before the cache is flushed." );
+
+	[cache flush];
+	XCTAssertFalse( cache.hasPendingChanges, @"Cache should not have pending changes after flushing." );
+	XCTAssertEqualObjects( [storage objectsForKeys:@[ @"key" ]][@"key"], @"value", @"Storage should be written to when the cache is flushed." );
+}
+
+- (void)test_cacheLifetime {
+	__weak JSMStaticMemoryStorage *weakStorage = nil;
+	__weak JSMStaticPreferenceCache *weakCache = nil;
+	@autoreleasepool {
+		JSMStaticMemoryStorage *storage = [JSMStaticMemoryStorage new];
+		JSMStaticPreferenceCache *cache = [JSMStaticPreferenceCache cacheForStorage:storage];
+		[cache setObject:@"value" forKey:@"key"];
+		weakStorage = storage;
+		weakCache = cache;
+	}
+
+	XCTAssertNotNil( weakStorage, @"Storage should be kept while its cache has unsaved changes." );
+	XCTAssertNotNil( weakCache, @"Cache should be kept while its storage is in use." );
+
+	@autoreleasepool {
+		JSMStaticPreferenceCache *cache = weakCache;
+		[cache flush];
+		XCTAssertEqualObjects( [cache.storage objectsForKeys:@[ @"key" ]][@"key"], @"value", @"Storage should be written to when the cache is flushed." );
+	}
+
+	XCTAssertNil( weakStorage, @"Storage should be released once its changes are written." );
+	XCTAssertNil( weakCache, @"Cache should be released along with its storage." );
+}
+
+- (void)test_preferenceStorage {
+	JSMStaticMemoryStorage *storage = [JSMStaticMemoryStorage new];
+	JSMStaticDataSource *dataSource = [JSMStaticDataSource new];
+	dataSource.preferenceStorage = storage;
+
+	JSMStaticPreference *preference = [JSMStaticPreference preferenceWithKey:@"JSMPreferenceStorageTests"];
+	[[dataSource createSection] addRow:preference];
+	preference.value = @YES;
+
+	id value = [[JSMStaticPreferenceCache cacheForStorage:storage] objectForKey:@"JSMPreferenceStorageTests"];
+	XCTAssertEqualObjects( value, @YES, @"Preference should use the data source's storage." );
+	XCTAssertEqual( CFGetTypeID( (__bridge CFTypeRef)value ), CFBooleanGetTypeID(), @"Boolean values should be stored as booleans." );
+}
+
+- (void)test_pendingValues {
+	JSMStaticPreference *preference = [JSMStaticPreference transientPreferenceWithKey:@"JSMPreferenceStorageTests.pending"];
+	JSMStaticPreference *otherPreference = [JSMStaticPreference transientPreferenceWithKey:@"JSMPreferenceStorageTests.otherPending"];
+
+	[preference setValue:@"first" afterDelay:0.1];
+	[preference setValue:@"second" afterDelay:0.1];
+	[otherPreference setValue:@"other" afterDelay:0.1];
+	XCTAssertTrue( preference.hasPendingValue, @"Preference should have a pending value." );
+	XCTAssertNil( preference.value, @"Pending values should not be committed before the delay." );
+
+	[otherPreference commitPendingValue];
+	XCTAssertEqualObjects( otherPreference.value, @"other", @"Pending values should be committed on request." );
+
+	[[NSRunLoop mainRunLoop] runUntilDate:[NSDate dateWithTimeIntervalSinceNow:0.3]];
+	XCTAssertFalse( preference.hasPendingValue, @"Pending values should be committed after the delay." );
+	XCTAssertEqualObjects( preference.value, @"second", @"Only the latest pending value should be committed." );
+}
+
+- (void)test_scalarValues {
+	JSMStaticMemoryStorage *storage = [JSMStaticMemoryStorage new];
+	JSMStaticPreferenceCache *cache = [JSMStaticPreferenceCache cacheForStorage:storage];
+
+	JSMStaticBooleanPreference *preference = [JSMStaticBooleanPreference preferenceWithKey:@"JSMPreferenceStorageTests.bool"];
+	preference.storage = storage;
+	[preference addObserver:self];
+
+	preference.boolValue = YES;
+	preference.boolValue = YES;
+	XCTAssertTrue( preference.boolValue, @"Preference should return the scalar value." );
+	XCTAssertEqualObjects( preference.value, @YES, @"Preference should provide the scalar value as an object." );
+	XCTAssertEqual( CFGetTypeID( (__bridge CFTypeRef)preference.value ), CFBooleanGetTypeID(), @"Boolean scalar values should be provided as booleans." );
+	XCTAssertEqual( self.numberOfBoolValueChanges, 1, @"Observers should only be notified when the value changes." );
+	XCTAssertTrue( self.lastBoolValue, @"Observers should be sent the scalar value." );
+
+	[cache flush];
+	id storedValue = [storage objectsForKeys:@[ @"JSMPreferenceStorageTests.bool" ]][@"JSMPreferenceStorageTests.bool"];
+	XCTAssertEqualObjects( storedValue, @YES, @"Scalar values should be written to the storage as objects." );
+	XCTAssertEqual( CFGetTypeID( (__bridge CFTypeRef)storedValue ), CFBooleanGetTypeID(), @"Boolean scalar values should be written to the storage as booleans." );
+
+	JSMStaticBooleanPreference *transientPreference = [JSMStaticBooleanPreference transientPreferenceWithKey:@"JSMPreferenceStorageTests.transientBool"];
+	transientPreference.boolValue = YES;
+	XCTAssertEqual( CFGetTypeID( (__bridge CFTypeRef)transientPreference.value ), CFBooleanGetTypeID(), @"Transient boolean values should be provided as booleans." );
+
+	JSMStaticSliderPreference *slider = [JSMStaticSliderPreference transientPreferenceWithKey:@"JSMPreferenceStorageTests.double"];
+	slider.defaultValue = @0.25;
+	XCTAssertEqualWithAccuracy( slider.floatValue, 0.25, 0.0001, @"Preference should fall back to the default value." );
+	slider.floatValue = 0.75;
+	XCTAssertEqualWithAccuracy( slider.floatValue, 0.75, 0.0001, @"Transient preferences should store scalar values." );
+	XCTAssertEqualObjects( slider.value, @0.75, @"Transient preferences should provide the scalar value as an object." );
+}
+
+- (void)test_throttledSlider {
+	JSMPreferenceStorageTestsStorage *storage = [JSMPreferenceStorageTestsStorage new];
+	JSMStaticPreferenceCache *cache = [JSMStaticPreferenceCache cacheForStorage:storage];
+
+	JSMStaticSliderPreference *preference = [JSMPreferenceStorageTestsSliderPreference preferenceWithKey:@"JSMPreferenceStorageTests.slider"];
+	preference.storage = storage;
+	preference.continuousUpdateInterval = 60;
+	[preference loadControlIfNeeded];
+
+	__block NSUInteger numberOfHandledValues = 0;
+	preference.sliderValueHandler = ^(JSMStaticSliderPreference *sliderPreference, float value) {
+		numberOfHandledValues += 1;
+	};
+
+	JSMPreferenceStorageTestsSlider *slider = (JSMPreferenceStorageTestsSlider *)preference.slider;
+	slider.tracking = YES;
+	for( NSNumber *value in @[ @0.25, @0.5, @0.75 ] ) {
+		slider.value = value.floatValue;
+		[preference sliderChanged:slider];
+	}
+
+	XCTAssertEqual( numberOfHandledValues, (NSUInteger)3, @"Slider value handler should be called for every change." );
+	XCTAssertEqualObjects( preference.value, @0.25f, @"Value should be the live value while the slider is dragged." );
+	XCTAssertFalse( cache.hasPendingChanges, @"Live values should not be stored while the slider is dragged." );
+
+	slider.tracking = NO;
+	[preference sliderDidEndTracking:slider];
+	[cache flush];
+
+	XCTAssertEqualObjects( preference.value, @0.75, @"Value should be stored once the drag ends." );
+	XCTAssertEqual( storage.numberOfWrites, (NSUInteger)1, @"Storage should only be written to once for the drag." );
+	XCTAssertEqual( preference.numberOfCommitsSaved, (NSUInteger)2, @"Every change but the last should be counted as a saved commit." );
+}
+
+#pragma mark - Preference Observer
+
+- (void)preference:(JSMStaticPreference *)preference didChangeBoolValue:(BOOL)value {
+	self.numberOfBoolValueChanges += 1;
+	self.lastBoolValue = value;
+}
+
+@end
+
+@implementation JSMPreferenceStorageTestsSlider
+
+@synthesize tracking = _tracking;
+
+@end
+
+@implementation JSMPreferenceStorageTestsSliderPreference
+
+- (void)loadControl {
+	self.control = [[JSMPreferenceStorageTestsSlider alloc] init];
+}
+
+@end
+
+@implementation JSMPreferenceStorageTestsStorage
+
+- (void)setObjects:(NSDictionary<NSString *, id> *)objects {
+	[super setObjects:objects];
+	self.numberOfWrites += 1;
+}
+
+@end
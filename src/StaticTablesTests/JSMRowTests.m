@@ -141,4 +141,85 @@
 	XCTAssertTrue(row.canBeDeleted, @"Row marked as being deletable doesn't indicate it can be deleted.");
 }
 
+- (void)test_controlConstraints {
+	JSMStaticTextPreference *preference = [JSMStaticTextPreference preferenceWithKey:@"JSMRowTests"];
+	preference.fitControlToCell = YES;
+
+	UITableViewCell *cell = [[UITableViewCell alloc] initWithStyle:UITableViewCellStyleDefault reuseIdentifier:nil];
+	UITableViewCell *otherCell = [[UITableViewCell alloc] initWithStyle:UITableViewCellStyleDefault reuseIdentifier:nil];
+	NSUInteger count = [JSMStaticPreference numberOfActiveControlConstraints];
+
+	[preference prepareCell:cell];
+	NSUInteger installed = [JSMStaticPreference numberOfActiveControlConstraints] - count;
+	XCTAssertGreaterThan( installed, 0, @"Preparing a cell should install constraints for the control." );
+
+	[preference prepareCell:cell];
+	XCTAssertEqual( [JSMStaticPreference numberOfActiveControlConstraints] - count, installed, @"Preparing the same cell again should not install more constraints." );
+
+	[preference prepareCell:otherCell];
+	XCTAssertEqual( [JSMStaticPreference numberOfActiveControlConstraints] - count, installed, @"Moving the control to another cell should replace its constraints." );
+
+	preference.fitControlToCell = NO;
+	XCTAssertEqual( [JSMStaticPreference numberOfActiveControlConstraints], count, @"Constraints should be removed when the control is no longer fitted to the cell." );
+}
+
+- (void)test_skippedCellPropertyWrites {
+	JSMStaticRow *row = self.row;
+	UITableViewCell *cell = [[UITableViewCell alloc] initWithStyle:UITableViewCellStyleValue1 reuseIdentifier:nil];
+
+	[row prepareCell:cell];
+	XCTAssertEqualObjects(cell.textLabel.text, row.text, @"Prepared cell doesn't show the row's text.");
+
+	NSUInteger writes = [JSMStaticRow numberOfCellPropertyWrites];
+	NSUInteger skippedWrites = [JSMStaticRow numberOfSkippedCellPropertyWrites];
+
+	[row prepareCell:cell];
+	XCTAssertEqual([JSMStaticRow numberOfCellPropertyWrites], writes, @"Preparing an unchanged cell shouldn't write to any properties.");
+	XCTAssertGreaterThan([JSMStaticRow numberOfSkippedCellPropertyWrites], skippedWrites, @"Preparing an unchanged cell doesn't count skipped writes.");
+
+	cell.textLabel.text = @"Other";
+	[row prepareCell:cell];
+	XCTAssertEqual([JSMStaticRow numberOfCellPropertyWrites], writes + 1, @"Only the changed property should be written.");
+	XCTAssertEqualObjects(cell.textLabel.text, row.text, @"Changed property wasn't written back to the cell.");
+}
+
+- (void)test_selectOptions {
+	JSMStaticSelectPreference *preference = [JSMStaticSelectPreference preferenceWithKey:@"JSMRowTests.select"];
+	preference.options = @[
+						   @{ JSMStaticSelectOptionLabel: @"Missing value" },
+						   @{ JSMStaticSelectOptionValue: @"a", JSMStaticSelectOptionLabel: @"Apple" },
+						   @{ JSMStaticSelectOptionValue: @"b" },
+						   @{ JSMStaticSelectOptionValue: @"a", JSMStaticSelectOptionLabel: @"Apricot" },
+						   ];
+
+	XCTAssertEqualObjects(preference.defaultValue, @"a", @"Default value should be the first valid option.");
+	XCTAssertEqualObjects([preference optionForValue:@"a"].label, @"Apple", @"The first option with a given value should be used.");
+	XCTAssertEqual([preference optionForValue:@"a"].index, (NSUInteger)1, @"Option should know its position within the options.");
+	XCTAssertEqualObjects([preference optionForValue:@"b"].label, @"b", @"Options without a label should use their value.");
+	XCTAssertNil([preference optionForValue:@"c"], @"Unknown values shouldn't have an option.");
+}
+
+- (void)test_fileOptionSource {
+	NSURL *fileURL = [NSURL fileURLWithPath:[NSTemporaryDirectory() stringByAppendingPathComponent:NSUUID.UUID.UUIDString]];
+	[@"a\tApple\tapple-icon\r\n\nb\nc\tCherry\na\tApricot\n" writeToURL:fileURL atomically:YES encoding:NSUTF8StringEncoding error:nil];
+
+	JSMStaticFileOptionSource *source = [[JSMStaticFileOptionSource alloc] initWithFileURL:fileURL error:nil];
+	XCTAssertEqual(source.numberOfOptions, (NSUInteger)4, @"Empty lines shouldn't be counted as options.");
+	XCTAssertEqualObjects([source optionAtIndex:0].label, @"Apple", @"Option label should be read from the second column.");
+	XCTAssertEqualObjects([source optionAtIndex:0].imageName, @"apple-icon", @"Option image name should be read from the third column.");
+	XCTAssertEqualObjects([source optionAtIndex:1].label, @"b", @"Options without a label should use their value.");
+	XCTAssertEqualObjects([source labelAtIndex:2], @"Cherry", @"Labels should be read without creating the option.");
+	XCTAssertEqualObjects([source labelAtIndex:1], @"b", @"Labels read without creating the option should fall back to the value.");
+	XCTAssertEqual([source indexOfOptionWithValue:@"c"], (NSUInteger)2, @"Value lookup should return the option's position.");
+	XCTAssertEqual([source indexOfOptionWithValue:@"a"], (NSUInteger)0, @"Value lookup should return the first option with the value.");
+	XCTAssertEqual([source indexOfOptionWithValue:@"d"], (NSUInteger)NSNotFound, @"Unknown values shouldn't be found.");
+
+	JSMStaticSelectPreference *preference = [JSMStaticSelectPreference preferenceWithKey:@"JSMRowTests.source"];
+	preference.optionSource = source;
+	XCTAssertEqualObjects(preference.defaultValue, @"a", @"Default value should be the source's first option.");
+	XCTAssertEqualObjects([preference optionForValue:@"c"].label, @"Cherry", @"Options should be provided by the source.");
+
+	[[NSFileManager defaultManager] removeItemAtURL:fileURL error:nil];
+}
+
 @end
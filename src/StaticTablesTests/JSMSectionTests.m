@@ -128,6 +128,18 @@
 	}
 }
 
+- (void)test_indexForRow {
+	[self.section insertRow:[JSMStaticRow rowWithKey:@"zero"] atIndex:0];
+	[self.section insertRow:self.section.rows.lastObject atIndex:1];
+	[self.section removeRowAtIndex:3];
+
+	for (NSUInteger i = 0; i < self.section.rows.count; i++) {
+		JSMStaticRow *row = self.section.rows[i];
+
+		XCTAssertEqual([self.section indexForRow:row], i, @"Index for row does not match the index in the rows array.");
+	}
+}
+
 - (void)test_removeRowAtIndex {
 	JSMStaticRow *row = self.section.rows[2];
 	[self.section removeRowAtIndex:2];
@@ -39,6 +39,10 @@
 
 @end
 
+@interface JSMStaticDelegateOverride : NSObject <UITableViewDelegate>
+
+@end
+
 @implementation JSMStaticDelegateTests
 
 - (void)setUp {
@@ -86,6 +90,42 @@
 	XCTAssertEqual(returnedIndexPath2.row, 123, @"Value returned from internal delegate should be returned when no override delegate exists.");
 }
 
+- (void)test_forwardingTarget {
+	JSMStaticDelegateViewController *viewController = [[JSMStaticDelegateViewController alloc] init];
+
+	UITableView *tableView = viewController.tableView;
+	SEL selector = @selector(tableView:willSelectRowAtIndexPath:);
+
+	XCTAssertEqual([(NSObject *)tableView.delegate forwardingTargetForSelector:selector], viewController, @"Methods only the internal delegate responds to should be forwarded directly to it.");
+
+	tableView.delegate = self;
+	XCTAssertEqual([(NSObject *)tableView.delegate forwardingTargetForSelector:selector], self, @"Methods that don't return void should be forwarded directly to the override delegate when one exists.");
+	XCTAssertNil([(NSObject *)tableView.delegate forwardingTargetForSelector:@selector(tableView:didSelectRowAtIndexPath:)], @"Methods that return void should not be forwarded directly when both delegates respond.");
+
+	tableView.delegate = nil;
+	XCTAssertEqual([(NSObject *)tableView.delegate forwardingTargetForSelector:selector], viewController, @"Routes should be updated when the override delegate is removed.");
+}
+
+- (void)test_deallocatedOverrideDelegate {
+	JSMStaticDelegateViewController *viewController = [[JSMStaticDelegateViewController alloc] init];
+
+	UITableView *tableView = viewController.tableView;
+	NSIndexPath *indexPath = [NSIndexPath indexPathForRow:0 inSection:0];
+
+	@autoreleasepool {
+		JSMStaticDelegateOverride *overrideDelegate = [JSMStaticDelegateOverride new];
+		tableView.delegate = overrideDelegate;
+
+		NSIndexPath *returnedIndexPath = [tableView.delegate tableView:tableView willSelectRowAtIndexPath:indexPath];
+		XCTAssertEqual(returnedIndexPath.row, 456, @"Value returned from override delegate should be returned when one exists.");
+	}
+
+	NSIndexPath *returnedIndexPath = nil;
+	XCTAssertNoThrow(returnedIndexPath = [tableView.delegate tableView:tableView willSelectRowAtIndexPath:indexPath], @"Methods should still be handled after the override delegate is deallocated.");
+	XCTAssertTrue(viewController.didCallNonVoidMethod, @"Internal delegate should be called once the override delegate is deallocated.");
+	XCTAssertEqual(returnedIndexPath.row, 123, @"Value returned from internal delegate should be returned once the override delegate is deallocated.");
+}
+
 - (void)tableView:(UITableView *)tableView didSelectRowAtIndexPath:(NSIndexPath *)indexPath {
 	self.didCallVoidMethod = YES;
 }
@@ -118,3 +158,11 @@
 }
 
 @end
+
+@implementation JSMStaticDelegateOverride
+
+- (NSIndexPath *)tableView:(UITableView *)tableView willSelectRowAtIndexPath:(NSIndexPath *)indexPath {
+	return [NSIndexPath indexPathForRow:456 inSection:0];
+}
+
+@end